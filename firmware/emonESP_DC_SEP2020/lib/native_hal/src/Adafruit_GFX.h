@@ -0,0 +1,22 @@
+// emonDC host HAL, free to use and modify.
+
+#ifndef _NATIVE_ADAFRUIT_GFX_H
+#define _NATIVE_ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+
+#define WHITE 1
+
+// Text and bitmaps go nowhere, the OLED is not part of what is timed.
+class Adafruit_GFX : public Print
+{
+  public:
+    size_t write(const uint8_t *, size_t size) override { return size; }
+    void setRotation(uint8_t) {}
+    void setTextSize(uint8_t) {}
+    void setTextColor(uint16_t) {}
+    void setCursor(int16_t, int16_t) {}
+    void drawBitmap(int16_t, int16_t, const uint8_t *, int16_t, int16_t, uint16_t) {}
+};
+
+#endif // _NATIVE_ADAFRUIT_GFX_H
@@ -0,0 +1,21 @@
+// emonDC host HAL, free to use and modify.
+
+#ifndef _NATIVE_ADAFRUIT_SSD1306_H
+#define _NATIVE_ADAFRUIT_SSD1306_H
+
+#include <Adafruit_GFX.h>
+#include <Wire.h>
+
+#define SSD1306_SWITCHCAPVCC 0x02
+
+class Adafruit_SSD1306 : public Adafruit_GFX
+{
+  public:
+    Adafruit_SSD1306(uint8_t, uint8_t, TwoWire *, int8_t) {}
+    bool begin(uint8_t, uint8_t) { return true; }
+    void clearDisplay(void) {}
+    void display(void) {}
+    void ssd1306_command(uint8_t) {}
+};
+
+#endif // _NATIVE_ADAFRUIT_SSD1306_H
@@ -0,0 +1,132 @@
+// emonDC host HAL, free to use and modify.
+
+// The parts of the ESP8266 Arduino core the firmware uses, on the host.
+// See hal_native.h for how time, SPI, the RTC and the SD card behave.
+
+#ifndef _NATIVE_ARDUINO_H
+#define _NATIVE_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <sys/time.h>
+#include <algorithm>
+
+#include "WString.h"
+#include "hal_native.h"
+#include "esp8266_peri.h"
+
+// the HAL stands in for the ESP8266 core, so the ESP8266 code paths are built.
+// ARDUINO comes from the build flags, as with the real core.
+#ifndef ESP8266
+#define ESP8266
+#endif
+#define F_CPU 1000000000L // ESP.getCycleCount() counts host nanoseconds.
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+using std::min;
+using std::max;
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+#define ICACHE_RAM_ATTR
+#define IRAM_ATTR
+#define PROGMEM
+
+// AH_MCP320x's binary constants.
+#define B00000100 4
+#define B00001111 15
+#define B10000000 128
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define DEC 10
+#define HEX 16
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield(void);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+// timer1 runs from the simulated clock, 80MHz divided down as on the ESP8266.
+#define TIM_DIV1 0
+#define TIM_DIV16 1
+#define TIM_DIV256 3
+#define TIM_EDGE 0
+#define TIM_SINGLE 0
+#define TIM_LOOP 1
+typedef void (*timercallback)(void);
+void timer1_attachInterrupt(timercallback isr);
+void timer1_enable(uint8_t divider, uint8_t int_type, uint8_t reload);
+void timer1_write(uint32_t ticks);
+void timer1_disable(void);
+
+// the firmware sets the clock from the RTC and reads the hour, on the host
+// that is the simulated RTC rather than the machine's own clock.
+int hal_settimeofday(const struct timeval *tv, const struct timezone *tz);
+time_t hal_time(time_t *t);
+#define settimeofday(tv, tz) hal_settimeofday(tv, tz)
+#define time(t) hal_time(t)
+
+class Print
+{
+  public:
+    virtual ~Print() {}
+    virtual size_t write(const uint8_t *buffer, size_t size);
+    size_t write(uint8_t c) { return write(&c, 1); }
+    size_t print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+    size_t print(const String &s) { return print(s.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v, int base = DEC) { return print((long)v, base); }
+    size_t print(unsigned int v, int base = DEC) { return print((unsigned long)v, base); }
+    size_t print(long v, int base = DEC) { return printf(base == HEX ? "%lx" : "%ld", v); }
+    size_t print(unsigned long v, int base = DEC) { return printf(base == HEX ? "%lx" : "%lu", v); }
+    size_t print(double v, int digits = 2) { return printf("%.*f", digits, v); }
+    template <typename T> size_t println(const T &v) { return print(v) + println(); }
+    template <typename T> size_t println(const T &v, int format) { return print(v, format) + println(); }
+    size_t println(void) { return print("\r\n"); }
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class HardwareSerial : public Print
+{
+  public:
+    void begin(unsigned long) {}
+    int available(void) { return 0; }
+    int read(void) { return -1; }
+    void flush(void) {}
+    size_t write(const uint8_t *buffer, size_t size) override;
+};
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+
+class EspClass
+{
+  public:
+    uint32_t getCycleCount(void) { return (uint32_t)(hal_host_ns() + hal_spi_bus_ns); }
+    uint16_t getCpuFreqMHz(void) { return 1000; }
+    uint32_t getFreeHeap(void) { return HAL_HEAP_SIZE - hal_heap_in_use; }
+    uint32_t getMaxFreeBlockSize(void) { return getFreeHeap(); }
+    uint8_t getHeapFragmentation(void) { return 0; }
+    uint32_t getFreeSketchSpace(void) { return 0; }
+    void reset(void) { exit(0); }
+    void restart(void) { exit(0); }
+};
+extern EspClass ESP;
+
+#endif // _NATIVE_ARDUINO_H
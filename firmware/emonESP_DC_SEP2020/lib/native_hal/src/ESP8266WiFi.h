@@ -0,0 +1,20 @@
+// emonDC host HAL, free to use and modify.
+
+#ifndef _NATIVE_ESP8266WIFI_H
+#define _NATIVE_ESP8266WIFI_H
+
+#include <Arduino.h>
+
+// The host is never associated, NTP and the network sinks stay out of it.
+#define WL_CONNECTED 3
+#define WL_DISCONNECTED 6
+
+class ESP8266WiFiClass
+{
+  public:
+    int status(void) { return WL_DISCONNECTED; }
+    int RSSI(void) { return 0; }
+};
+extern ESP8266WiFiClass WiFi;
+
+#endif // _NATIVE_ESP8266WIFI_H
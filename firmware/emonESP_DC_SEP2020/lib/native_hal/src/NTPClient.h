@@ -0,0 +1,19 @@
+// emonDC host HAL, free to use and modify.
+
+#ifndef _NATIVE_NTPCLIENT_H
+#define _NATIVE_NTPCLIENT_H
+
+#include <WiFiUdp.h>
+
+// Never gets an answer, the time comes from the simulated RTC.
+class NTPClient
+{
+  public:
+    NTPClient(WiFiUDP &, const char *, long = 0, unsigned long = 60000) {}
+    void begin(void) {}
+    bool update(void) { return false; }
+    void setTimeOffset(long) {}
+    unsigned long getEpochTime(void) { return hal_rtc_now(); }
+};
+
+#endif // _NATIVE_NTPCLIENT_H
@@ -0,0 +1,39 @@
+// emonDC host HAL, free to use and modify.
+
+// DateTime and the PCF8523 as RTClib has them, the clock is the simulated one.
+
+#ifndef _NATIVE_RTCLIB_H
+#define _NATIVE_RTCLIB_H
+
+#include <Arduino.h>
+
+class DateTime
+{
+  public:
+    DateTime(uint32_t t = 0);
+    DateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour = 0, uint8_t min = 0, uint8_t sec = 0);
+    uint16_t year() const { return yOff + 2000; }
+    uint8_t month() const { return m; }
+    uint8_t day() const { return d; }
+    uint8_t hour() const { return hh; }
+    uint8_t minute() const { return mm; }
+    uint8_t second() const { return ss; }
+    uint8_t dayOfTheWeek() const;
+    uint32_t unixtime(void) const;
+    // YYYY, MM, DD, hh, mm and ss in buffer are replaced by the date and time.
+    char *toString(char *buffer) const;
+
+  private:
+    uint8_t yOff, m, d, hh, mm, ss;
+};
+
+class RTC_PCF8523
+{
+  public:
+    bool begin(void) { return true; }
+    bool initialized(void) { return hal_rtc_running(); }
+    DateTime now(void) { return DateTime(hal_rtc_now()); }
+    void adjust(const DateTime &dt) { hal_rtc_set(dt.unixtime()); }
+};
+
+#endif // _NATIVE_RTCLIB_H
@@ -0,0 +1,53 @@
+// emonDC host HAL, free to use and modify.
+
+// The SD library's File and SD, over files in a host directory, hal_sd_root().
+
+#ifndef _NATIVE_SD_H
+#define _NATIVE_SD_H
+
+#include <Arduino.h>
+#include <SPI.h>
+
+#define FILE_READ 0
+#define FILE_WRITE 1
+
+class File : public Print
+{
+  public:
+    File(FILE *f = NULL, const char *name = "", bool directory = false);
+    operator bool() const { return _f != NULL || _directory; }
+    size_t write(const uint8_t *buffer, size_t size) override;
+    int read(void);
+    int read(uint8_t *buffer, size_t size);
+    int available(void);
+    bool seek(uint32_t position);
+    uint32_t position(void);
+    uint32_t size(void);
+    void flush(void);
+    void close(void);
+    const char *name(void) const { return _name.c_str(); }
+    bool isDirectory(void) const { return _directory; }
+    File openNextFile(void) { return File(); }
+    time_t getLastWrite(void) { return 0; }
+
+  private:
+    FILE *_f;
+    String _name;
+    bool _directory;
+};
+
+class SDClass
+{
+  public:
+    bool begin(uint8_t cs, const SPISettings &settings = SPISettings());
+    File open(const char *name, uint8_t mode = FILE_READ);
+    File open(const String &name, uint8_t mode = FILE_READ) { return open(name.c_str(), mode); }
+    bool exists(const char *name);
+    bool exists(const String &name) { return exists(name.c_str()); }
+    bool remove(const char *name);
+    bool remove(const String &name) { return remove(name.c_str()); }
+    bool mkdir(const char *name);
+};
+extern SDClass SD;
+
+#endif // _NATIVE_SD_H
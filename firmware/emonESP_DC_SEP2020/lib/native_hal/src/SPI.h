@@ -0,0 +1,32 @@
+// emonDC host HAL, free to use and modify.
+
+// SPI with an MCP3208 model on the bus, see hal_native.h.
+
+#ifndef _NATIVE_SPI_H
+#define _NATIVE_SPI_H
+
+#include <Arduino.h>
+
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+class SPISettings
+{
+  public:
+    SPISettings(uint32_t clock = 1000000, uint8_t /*bitOrder*/ = MSBFIRST, uint8_t /*dataMode*/ = SPI_MODE0)
+      : _clock(clock) {}
+    uint32_t _clock;
+};
+
+class SPIClass
+{
+  public:
+    void begin(void) {}
+    void beginTransaction(const SPISettings &settings) { SPI1CLK = hal_spi1_clock_reg(settings._clock); }
+    void endTransaction(void) {}
+    uint8_t transfer(uint8_t data);
+    void transferBytes(const uint8_t *out, uint8_t *in, uint32_t size);
+};
+extern SPIClass SPI;
+
+#endif // _NATIVE_SPI_H
@@ -0,0 +1,79 @@
+// emonDC host HAL, free to use and modify.
+
+// The Arduino String, over std::string, with the members the firmware uses.
+
+#ifndef _NATIVE_WSTRING_H
+#define _NATIVE_WSTRING_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string>
+
+class String
+{
+  public:
+    String() {}
+    String(const char *s) : _s(s ? s : "") {}
+    String(const std::string &s) : _s(s) {}
+    String(char c) : _s(1, c) {}
+    String(int v) : _s(std::to_string(v)) {}
+    String(unsigned int v) : _s(std::to_string(v)) {}
+    String(long v) : _s(std::to_string(v)) {}
+    String(unsigned long v) : _s(std::to_string(v)) {}
+    String(long long v) : _s(std::to_string(v)) {}
+    String(unsigned long long v) : _s(std::to_string(v)) {}
+    String(float v, unsigned char decimals = 2) { format(v, decimals); }
+    String(double v, unsigned char decimals = 2) { format(v, decimals); }
+
+    const char *c_str() const { return _s.c_str(); }
+    unsigned int length() const { return _s.length(); }
+    char operator[](unsigned int i) const { return _s[i]; }
+    char charAt(unsigned int i) const { return _s[i]; }
+    long toInt() const { return atol(_s.c_str()); }
+    float toFloat() const { return atof(_s.c_str()); }
+    double toDouble() const { return atof(_s.c_str()); }
+    int indexOf(char c, unsigned int from = 0) const { return find(_s.find(c, from)); }
+    int indexOf(const String &s, unsigned int from = 0) const { return find(_s.find(s._s, from)); }
+    int lastIndexOf(char c) const { return find(_s.rfind(c)); }
+    String substring(unsigned int from) const { return from < _s.size() ? _s.substr(from) : std::string(); }
+    String substring(unsigned int from, unsigned int to) const {
+      if (from > to) { unsigned int t = from; from = to; to = t; }
+      return from < _s.size() ? _s.substr(from, to - from) : std::string();
+    }
+    bool startsWith(const String &s) const { return _s.compare(0, s._s.size(), s._s) == 0; }
+    bool endsWith(const String &s) const {
+      return _s.size() >= s._s.size() && _s.compare(_s.size() - s._s.size(), s._s.size(), s._s) == 0;
+    }
+    void trim() {
+      size_t a = _s.find_first_not_of(" \t\r\n"), b = _s.find_last_not_of(" \t\r\n");
+      _s = a == std::string::npos ? std::string() : _s.substr(a, b - a + 1);
+    }
+    void reserve(unsigned int n) { _s.reserve(n); }
+
+    String &operator+=(const String &s) { _s += s._s; return *this; }
+    String &operator+=(const char *s) { _s += s; return *this; }
+    String &operator+=(char c) { _s += c; return *this; }
+    bool operator==(const String &s) const { return _s == s._s; }
+    bool operator==(const char *s) const { return _s == (s ? s : ""); }
+    bool operator!=(const String &s) const { return _s != s._s; }
+    bool operator!=(const char *s) const { return !(*this == s); }
+    bool operator<(const String &s) const { return _s < s._s; }
+
+    friend String operator+(const String &a, const String &b) { return a._s + b._s; }
+    friend String operator+(const String &a, const char *b) { return a._s + b; }
+    friend String operator+(const char *a, const String &b) { return a + b._s; }
+
+  private:
+    std::string _s;
+    static int find(size_t at) { return at == std::string::npos ? -1 : (int)at; }
+    void format(double v, unsigned char decimals) {
+      char buffer[64];
+      snprintf(buffer, sizeof(buffer), "%.*f", decimals, v);
+      _s = buffer;
+    }
+};
+
+#define F(s) (s)
+typedef const char __FlashStringHelper;
+
+#endif // _NATIVE_WSTRING_H
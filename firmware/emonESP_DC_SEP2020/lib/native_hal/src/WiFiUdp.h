@@ -0,0 +1,12 @@
+// emonDC host HAL, free to use and modify.
+
+#ifndef _NATIVE_WIFIUDP_H
+#define _NATIVE_WIFIUDP_H
+
+#include <ESP8266WiFi.h>
+
+class WiFiUDP
+{
+};
+
+#endif // _NATIVE_WIFIUDP_H
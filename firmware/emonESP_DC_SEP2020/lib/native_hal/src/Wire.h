@@ -0,0 +1,16 @@
+// emonDC host HAL, free to use and modify.
+
+#ifndef _NATIVE_WIRE_H
+#define _NATIVE_WIRE_H
+
+#include <Arduino.h>
+
+// Nothing on the I2C bus, the RTC stands in at the RTClib level.
+class TwoWire
+{
+  public:
+    void begin(void) {}
+};
+extern TwoWire Wire;
+
+#endif // _NATIVE_WIRE_H
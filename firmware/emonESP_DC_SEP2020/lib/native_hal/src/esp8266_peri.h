@@ -0,0 +1,58 @@
+// emonDC host HAL, free to use and modify.
+
+// The HSPI and GPIO registers AH_MCP320x::readBurst() drives directly. A write
+// of SPIBUSY to SPI1CMD clocks SPI1U1's bit length out of SPI1W0, low byte
+// first, and leaves what came back in SPI1W0. GPOS and GPOC set and clear
+// pins as digitalWrite() does. The transfer is done by the time SPI1CMD is
+// written, so SPIBUSY always reads back clear. SPI1CLK divides the 80MHz APB
+// clock as on the chip, SPI.beginTransaction() sets it; each transfer's bits
+// are timed at that clock into hal_spi_bus_ns.
+
+#ifndef _NATIVE_ESP8266_PERI_H
+#define _NATIVE_ESP8266_PERI_H
+
+#include <stdint.h>
+
+#define SPIBUSY  (1UL << 18)
+#define SPILMOSI 17
+#define SPILMISO 8
+#define SPIMMOSI 0x1FF
+#define SPIMMISO 0x1FF
+
+#define SPICLK_EQU_SYSCLK (1UL << 31)
+#define SPICLKDIV_PRE 0x1FFF
+#define SPICLKDIV_PRE_S 18
+#define SPICLKCNT_N 0x3F
+#define SPICLKCNT_N_S 12
+#define SPICLKCNT_H 0x3F
+#define SPICLKCNT_H_S 6
+#define SPICLKCNT_L 0x3F
+#define SPICLKCNT_L_S 0
+
+extern volatile uint32_t SPI1W0;
+extern volatile uint32_t SPI1U1;
+extern volatile uint32_t SPI1CLK;
+
+void hal_spi1_start(void);
+// SPI1CLK for a bus clock, as the core's SPI.setFrequency() works it out.
+uint32_t hal_spi1_clock_reg(uint32_t hz);
+void hal_gpio_set(uint32_t mask);
+void hal_gpio_clear(uint32_t mask);
+
+struct hal_spi1_cmd_t {
+  operator uint32_t() const { return 0; }
+  hal_spi1_cmd_t &operator|=(uint32_t value) {
+    if (value & SPIBUSY) hal_spi1_start();
+    return *this;
+  }
+};
+extern hal_spi1_cmd_t SPI1CMD;
+
+struct hal_gpio_reg_t {
+  void (*apply)(uint32_t);
+  hal_gpio_reg_t &operator=(uint32_t mask) { apply(mask); return *this; }
+};
+extern hal_gpio_reg_t GPOS;
+extern hal_gpio_reg_t GPOC;
+
+#endif // _NATIVE_ESP8266_PERI_H
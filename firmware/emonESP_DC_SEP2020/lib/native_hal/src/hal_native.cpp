@@ -0,0 +1,433 @@
+// emonDC host HAL, free to use and modify.
+
+// See hal_native.h. Everything here runs in one thread: the timer1 ISR is
+// called from hal_advance_us(), between passes of whatever drives the clock.
+
+#include <chrono>
+#include <new>
+#include <malloc.h>
+#include <sys/stat.h>
+#include <errno.h>
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <SD.h>
+#include <RTClib.h>
+#include <Wire.h>
+#include <ESP8266WiFi.h>
+
+HardwareSerial Serial;
+HardwareSerial Serial1;
+EspClass ESP;
+SPIClass SPI;
+SDClass SD;
+TwoWire Wire;
+ESP8266WiFiClass WiFi;
+
+bool hal_serial_echo = false;
+
+
+//-------------------------
+// Clock and timer1
+//-------------------------
+static uint64_t hal_clock_ns = 0;
+static timercallback hal_timer1_isr = NULL;
+static bool hal_timer1_enabled = false;
+static bool hal_timer1_loop = false;
+static uint8_t hal_timer1_divider = TIM_DIV16;
+static uint64_t hal_timer1_period_ns = 0;
+static uint64_t hal_timer1_next_ns = 0;
+static bool hal_in_isr = false;
+
+uint64_t hal_now_us(void) { return hal_clock_ns / 1000; }
+
+uint64_t hal_host_ns(void) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void hal_advance_us(uint64_t us) {
+  uint64_t until = hal_clock_ns + us * 1000;
+  if (hal_in_isr) { // delays inside the ISR only take time.
+    hal_clock_ns = until;
+    return;
+  }
+  while (hal_timer1_enabled && hal_timer1_isr && hal_timer1_next_ns <= until) {
+    hal_clock_ns = hal_timer1_next_ns;
+    if (hal_timer1_loop) hal_timer1_next_ns += hal_timer1_period_ns;
+    else hal_timer1_enabled = false;
+    hal_in_isr = true;
+    hal_timer1_isr();
+    hal_in_isr = false;
+  }
+  hal_clock_ns = until;
+}
+
+unsigned long millis(void) { return hal_clock_ns / 1000000; }
+unsigned long micros(void) { return hal_clock_ns / 1000; }
+void delay(unsigned long ms) { hal_advance_us((uint64_t)ms * 1000); }
+void delayMicroseconds(unsigned int us) { hal_advance_us(us); }
+void yield(void) {}
+
+void timer1_attachInterrupt(timercallback isr) { hal_timer1_isr = isr; }
+
+void timer1_enable(uint8_t divider, uint8_t, uint8_t reload) { // always edge triggered.
+  hal_timer1_divider = divider;
+  hal_timer1_loop = reload == TIM_LOOP;
+  hal_timer1_enabled = true;
+}
+
+void timer1_write(uint32_t ticks) {
+  // 80MHz through the divider, 1, 16 or 256.
+  static const uint16_t dividers[4] = {1, 16, 16, 256};
+  hal_timer1_period_ns = (uint64_t)ticks * dividers[hal_timer1_divider & 3] * 1000 / 80;
+  if (hal_timer1_period_ns == 0) hal_timer1_period_ns = 1;
+  hal_timer1_next_ns = hal_clock_ns + hal_timer1_period_ns;
+}
+
+void timer1_disable(void) { hal_timer1_enabled = false; }
+
+
+//-------------------------
+// RTC and system time
+//-------------------------
+static bool hal_rtc_set_once = false;
+static uint32_t hal_rtc_base = 0;
+static uint64_t hal_rtc_base_ns = 0;
+static uint32_t hal_sys_base = 0;
+static uint64_t hal_sys_base_ns = 0;
+
+void hal_rtc_set(uint32_t unixtime) {
+  hal_rtc_base = unixtime;
+  hal_rtc_base_ns = hal_clock_ns;
+  hal_rtc_set_once = true;
+}
+
+uint32_t hal_rtc_now(void) { return hal_rtc_base + (hal_clock_ns - hal_rtc_base_ns) / 1000000000ULL; }
+bool hal_rtc_running(void) { return hal_rtc_set_once; }
+
+int hal_settimeofday(const struct timeval *tv, const struct timezone *) {
+  hal_sys_base = tv->tv_sec;
+  hal_sys_base_ns = hal_clock_ns;
+  return 0;
+}
+
+#undef time
+time_t hal_time(time_t *t) {
+  time_t now = hal_sys_base + (hal_clock_ns - hal_sys_base_ns) / 1000000000ULL;
+  if (t) *t = now;
+  return now;
+}
+
+
+//-------------------------
+// Serial
+//-------------------------
+size_t Print::write(const uint8_t *, size_t size) { return size; }
+
+size_t Print::printf(const char *format, ...) {
+  char buffer[256];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  if (len < 0) return 0;
+  return write((const uint8_t *)buffer, min((size_t)len, sizeof(buffer) - 1));
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+  if (hal_serial_echo) fwrite(buffer, 1, size, stdout);
+  return size;
+}
+
+
+//-------------------------
+// GPIO and SPI, with the MCP3208
+//-------------------------
+int hal_mcp3208_cs = 2;
+uint16_t hal_mcp3208_values[8];
+uint64_t hal_spi_clocks = 0;
+uint64_t hal_spi_selects = 0;
+uint64_t hal_spi_bus_ns = 0;
+volatile uint32_t SPI1W0 = 0;
+volatile uint32_t SPI1U1 = 0;
+// SPI.begin()'s 1MHz, a constant so it is set before any constructor runs.
+volatile uint32_t SPI1CLK = ((40 - 1) << SPICLKDIV_PRE_S) | (1 << SPICLKCNT_N_S) | (1 << SPICLKCNT_L_S);
+hal_spi1_cmd_t SPI1CMD;
+hal_gpio_reg_t GPOS = {hal_gpio_set};
+hal_gpio_reg_t GPOC = {hal_gpio_clear};
+
+static uint8_t hal_pins[17];
+// MCP3208 state: waiting for the start bit, taking the 4 config bits, then sending.
+enum { MCP_IDLE, MCP_START, MCP_CONFIG, MCP_SEND } static hal_mcp_state = MCP_IDLE;
+static uint8_t hal_mcp_bits = 0;
+static uint8_t hal_mcp_channel = 0;
+
+void hal_spi_reset_counts(void) {
+  hal_spi_clocks = 0;
+  hal_spi_selects = 0;
+}
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  if (pin > 16) return;
+  if (pin == hal_mcp3208_cs && hal_pins[pin] && !value) {
+    hal_spi_selects++;
+    hal_mcp_state = MCP_START;
+  }
+  if (pin == hal_mcp3208_cs && value) hal_mcp_state = MCP_IDLE;
+  hal_pins[pin] = value ? 1 : 0;
+}
+
+int digitalRead(uint8_t pin) { return pin <= 16 ? hal_pins[pin] : 0; }
+
+void hal_gpio_set(uint32_t mask) {
+  for (uint8_t pin = 0; pin < 16; pin++) if (mask & (1UL << pin)) digitalWrite(pin, HIGH);
+}
+
+void hal_gpio_clear(uint32_t mask) {
+  for (uint8_t pin = 0; pin < 16; pin++) if (mask & (1UL << pin)) digitalWrite(pin, LOW);
+}
+
+// One bus clock: a bit in from the master, a bit back out, after the
+// datasheet's start bit, SGL/DIFF, D2 D1 D0, a sample clock and a null bit.
+static uint8_t hal_mcp_clock(uint8_t in) {
+  hal_spi_clocks++;
+  switch (hal_mcp_state) {
+  case MCP_START:
+    if (in) {
+      hal_mcp_state = MCP_CONFIG;
+      hal_mcp_bits = 0;
+      hal_mcp_channel = 0;
+    }
+    return 0;
+  case MCP_CONFIG:
+    if (hal_mcp_bits > 0) hal_mcp_channel = (hal_mcp_channel << 1) | in; // after SGL/DIFF.
+    if (++hal_mcp_bits == 4) {
+      hal_mcp_state = MCP_SEND;
+      hal_mcp_bits = 0;
+    }
+    return 0;
+  case MCP_SEND: {
+    uint8_t bit = hal_mcp_bits++;
+    if (bit < 2 || bit >= 14) return 0;
+    return (hal_mcp3208_values[hal_mcp_channel & 7] >> (13 - bit)) & 1;
+  }
+  default:
+    return 0;
+  }
+}
+
+// the core's search, a counter divide of up to 64 and the prescaler, the
+// closest clock not above hz. 80MHz is the APB clock on its own.
+uint32_t hal_spi1_clock_reg(uint32_t hz) {
+  if (hz >= 80000000) return SPICLK_EQU_SYSCLK;
+  uint32_t best = 0, best_hz = 0;
+  for (uint32_t n = 2; n <= 64; n++) {
+    uint32_t pre = hz ? (80000000 / n + hz - 1) / hz : SPICLKDIV_PRE + 1;
+    if (pre < 1) pre = 1;
+    if (pre > SPICLKDIV_PRE + 1) pre = SPICLKDIV_PRE + 1;
+    uint32_t got = 80000000 / (pre * n);
+    if (got > best_hz) {
+      best_hz = got;
+      best = ((pre - 1) << SPICLKDIV_PRE_S) | ((n - 1) << SPICLKCNT_N_S)
+           | ((n / 2 - 1) << SPICLKCNT_H_S) | ((n - 1) << SPICLKCNT_L_S);
+    }
+  }
+  return best;
+}
+
+static uint32_t hal_spi1_hz(void) {
+  uint32_t clk = SPI1CLK;
+  if (clk & SPICLK_EQU_SYSCLK) return 80000000;
+  uint32_t pre = ((clk >> SPICLKDIV_PRE_S) & SPICLKDIV_PRE) + 1;
+  uint32_t n = ((clk >> SPICLKCNT_N_S) & SPICLKCNT_N) + 1;
+  return 80000000 / (pre * n);
+}
+
+uint8_t SPIClass::transfer(uint8_t data) {
+  hal_spi_bus_ns += 8 * 1000000000ULL / hal_spi1_hz();
+  uint8_t out = 0;
+  for (int8_t i = 7; i >= 0; i--) out = (out << 1) | hal_mcp_clock((data >> i) & 1);
+  return out;
+}
+
+void SPIClass::transferBytes(const uint8_t *out, uint8_t *in, uint32_t size) {
+  for (uint32_t i = 0; i < size; i++) {
+    uint8_t b = transfer(out ? out[i] : 0xFF);
+    if (in) in[i] = b;
+  }
+}
+
+void hal_spi1_start(void) {
+  uint8_t bits = ((SPI1U1 >> SPILMOSI) & SPIMMOSI) + 1;
+  uint32_t out = SPI1W0, in = 0;
+  for (uint8_t b = 0; b < bits && b < 32; b += 8) {
+    in |= (uint32_t)SPI.transfer((out >> b) & 0xFF) << b; // low byte first.
+  }
+  SPI1W0 = in;
+}
+
+
+//-------------------------
+// SD card, files under a host directory
+//-------------------------
+static String hal_sd_dir = "sd";
+
+void hal_sd_root(const char *path) { hal_sd_dir = path; }
+
+const char *hal_sd_path(const char *name, char *buffer, size_t size) {
+  while (*name == '/') name++;
+  snprintf(buffer, size, "%s/%s", hal_sd_dir.c_str(), name);
+  return buffer;
+}
+
+bool SDClass::begin(uint8_t, const SPISettings &) {
+  ::mkdir(hal_sd_dir.c_str(), 0755);
+  struct stat st;
+  return stat(hal_sd_dir.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+File SDClass::open(const char *name, uint8_t mode) {
+  char path[256];
+  hal_sd_path(name, path, sizeof(path));
+  struct stat st;
+  if (stat(path, &st) == 0 && S_ISDIR(st.st_mode)) return File(NULL, name, true);
+  // the SD library appends on FILE_WRITE, and can still read and seek.
+  FILE *f = fopen(path, mode == FILE_WRITE ? "a+b" : "rb");
+  return File(f, name);
+}
+
+bool SDClass::exists(const char *name) {
+  char path[256];
+  struct stat st;
+  return stat(hal_sd_path(name, path, sizeof(path)), &st) == 0;
+}
+
+bool SDClass::mkdir(const char *name) {
+  char path[256];
+  return ::mkdir(hal_sd_path(name, path, sizeof(path)), 0755) == 0 || errno == EEXIST;
+}
+
+bool SDClass::remove(const char *name) {
+  char path[256];
+  return ::remove(hal_sd_path(name, path, sizeof(path))) == 0;
+}
+
+File::File(FILE *f, const char *name, bool directory) : _f(f), _name(name), _directory(directory) {}
+
+size_t File::write(const uint8_t *buffer, size_t size) { return _f ? fwrite(buffer, 1, size, _f) : 0; }
+
+int File::read(void) {
+  uint8_t b;
+  return read(&b, 1) == 1 ? b : -1;
+}
+
+int File::read(uint8_t *buffer, size_t size) { return _f ? fread(buffer, 1, size, _f) : -1; }
+
+int File::available(void) { return _f ? size() - position() : 0; }
+
+bool File::seek(uint32_t position) { return _f && fseek(_f, position, SEEK_SET) == 0; }
+
+uint32_t File::position(void) { return _f ? ftell(_f) : 0; }
+
+uint32_t File::size(void) {
+  if (!_f) return 0;
+  struct stat st;
+  fflush(_f);
+  return fstat(fileno(_f), &st) == 0 ? st.st_size : 0;
+}
+
+void File::flush(void) { if (_f) fflush(_f); }
+
+void File::close(void) {
+  if (_f) fclose(_f);
+  _f = NULL;
+  _directory = false;
+}
+
+
+//-------------------------
+// DateTime, as RTClib works it out
+//-------------------------
+static const uint8_t hal_days_in_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+DateTime::DateTime(uint32_t t) {
+  t -= 946684800UL; // from 2000-01-01.
+  ss = t % 60; t /= 60;
+  mm = t % 60; t /= 60;
+  hh = t % 24;
+  uint16_t days = t / 24;
+  uint8_t leap;
+  for (yOff = 0;; yOff++) {
+    leap = yOff % 4 == 0;
+    if (days < 365U + leap) break;
+    days -= 365 + leap;
+  }
+  for (m = 1; m < 12; m++) {
+    uint8_t dim = hal_days_in_month[m - 1] + (m == 2 && leap);
+    if (days < dim) break;
+    days -= dim;
+  }
+  d = days + 1;
+}
+
+DateTime::DateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t min, uint8_t sec) {
+  yOff = year >= 2000 ? year - 2000 : year;
+  m = month;
+  d = day;
+  hh = hour;
+  mm = min;
+  ss = sec;
+}
+
+uint32_t DateTime::unixtime(void) const {
+  uint32_t days = d - 1;
+  for (uint8_t i = 1; i < m; i++) days += hal_days_in_month[i - 1];
+  if (m > 2 && yOff % 4 == 0) days++;
+  days += 365UL * yOff + (yOff + 3) / 4;
+  return ((days * 24UL + hh) * 60 + mm) * 60 + ss + 946684800UL;
+}
+
+uint8_t DateTime::dayOfTheWeek() const {
+  return (unixtime() / 86400UL + 4) % 7; // 1970-01-01 was a Thursday.
+}
+
+char *DateTime::toString(char *buffer) const {
+  char field[5];
+  const struct { const char *key; int value; int width; } fields[] = {
+    {"YYYY", year(), 4}, {"MM", m, 2}, {"DD", d, 2}, {"hh", hh, 2}, {"mm", mm, 2}, {"ss", ss, 2}};
+  for (auto &f : fields) {
+    char *at = strstr(buffer, f.key);
+    if (!at) continue;
+    snprintf(field, sizeof(field), "%0*d", f.width, f.value);
+    memcpy(at, field, f.width);
+  }
+  return buffer;
+}
+
+
+//-------------------------
+// Heap
+//-------------------------
+uint64_t hal_heap_allocations = 0;
+uint64_t hal_heap_bytes = 0;
+int64_t hal_heap_in_use = 0;
+
+void *operator new(size_t size) {
+  void *p = malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  hal_heap_allocations++;
+  hal_heap_bytes += size;
+  hal_heap_in_use += malloc_usable_size(p);
+  return p;
+}
+
+void operator delete(void *p) noexcept {
+  if (!p) return;
+  hal_heap_in_use -= malloc_usable_size(p);
+  free(p);
+}
+
+void operator delete(void *p, size_t) noexcept { operator delete(p); }
@@ -0,0 +1,59 @@
+// emonDC host HAL, free to use and modify.
+
+// The firmware is built for the host against these stand-ins for the ESP8266
+// core and the boards's peripherals (pio run -e native, pio test -e native).
+// Time is simulated: millis() and micros() only move when hal_advance_us() is
+// called, which also runs the timer1 interrupt for the ticks that fall due, so
+// a run sees the same samples at the same times whatever the host. The cost
+// figures are real: ESP.getCycleCount() counts host nanoseconds, with
+// ESP.getCpuFreqMHz() 1000 to match, so /status style cycle figures read as
+// host time, plus the time the SPI bus took at its clock, which the host
+// does not spend.
+//  - SPI: bus clock and time counters and an MCP3208 on the ADC chip select, see below.
+//  - RTC: the PCF8523 keeps the simulated time from hal_rtc_set().
+//  - SD: files under a host directory, hal_sd_root(), default ./sd.
+//  - Heap: every operator new is counted, ESP.getFreeHeap() follows them.
+
+#ifndef _NATIVE_HAL_H
+#define _NATIVE_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Simulated clock.
+uint64_t hal_now_us(void);
+// Move the clock on, running the timer1 ISR for each tick that falls due.
+void hal_advance_us(uint64_t us);
+// Host nanoseconds, for timing.
+uint64_t hal_host_ns(void);
+
+// RTC, unix time, counting on with the simulated clock.
+void hal_rtc_set(uint32_t unixtime);
+uint32_t hal_rtc_now(void);
+bool hal_rtc_running(void);
+
+// Directory the SD card's files are kept in.
+void hal_sd_root(const char *path);
+const char *hal_sd_path(const char *name, char *buffer, size_t size);
+
+// MCP3208 on the SPI bus, selected by hal_mcp3208_cs going low. Each
+// conversion returns hal_mcp3208_values[channel], single ended or not.
+extern int hal_mcp3208_cs;
+extern uint16_t hal_mcp3208_values[8];
+// SPI bus clocks and CS falling edges, for counting the cost of a read.
+extern uint64_t hal_spi_clocks;
+extern uint64_t hal_spi_selects;
+// ns the bus took at SPI1CLK's clock, never reset: ESP.getCycleCount() adds it.
+extern uint64_t hal_spi_bus_ns;
+void hal_spi_reset_counts(void);
+
+// Heap use, from operator new and delete.
+extern uint64_t hal_heap_allocations;
+extern uint64_t hal_heap_bytes;   // allocated in total.
+extern int64_t hal_heap_in_use;
+#define HAL_HEAP_SIZE 81920       // what ESP.getFreeHeap() counts down from.
+
+// Serial output to stdout, off by default so benchmarks are quiet.
+extern bool hal_serial_echo;
+
+#endif // _NATIVE_HAL_H
@@ -23,6 +23,19 @@
 #include "AH_MCP320x.h"
 #include <SPI.h>
 
+#if defined(ESP8266)
+//SPI1CLK for a clock from the 80MHz APB: the counter divides by 8, the
+//prescaler by the rest, rounded so the bus is never faster than asked.
+static uint32_t spiClockReg(uint32_t clock)
+{
+   const uint32_t n = 8;
+   uint32_t pre = clock ? (80000000UL / n + clock - 1) / clock : SPICLKDIV_PRE + 1;
+   if (pre < 1) pre = 1;
+   if (pre > SPICLKDIV_PRE + 1) pre = SPICLKDIV_PRE + 1;
+   return ((pre - 1) << SPICLKDIV_PRE_S) | ((n - 1) << SPICLKCNT_N_S)
+        | ((n / 2 - 1) << SPICLKCNT_H_S) | ((n - 1) << SPICLKCNT_L_S);
+}
+#endif
 
 
 //************************************************************************
@@ -59,7 +72,11 @@ AH_MCP320x::AH_MCP320x(int CS, int DOUT,int DIN, int CLK)
 AH_MCP320x::AH_MCP320x(int CS, SPISettings settings)
 {
   _CS   = CS;
+  _CS_MASK = (CS < 16) ? (1UL << CS) : 0; //GPIO0..15 can use the set/clear registers
   _MODE = 1; //SPI mode
+#if defined(ESP8266)
+  _SPI_CLK = spiClockReg(settings._clock); //readBurst's own clock, whatever the bus was left at
+#endif
   
   int i;
   for (i=0;i<8;i++){ 
@@ -123,6 +140,62 @@ void AH_MCP320x::readALL(int values[], int n)
    }
 } 
 
+//************************************************************************
+//BURST READ: one conversion per channel set in mask (bit n = channel n).
+//Each conversion is a single 24 bit HSPI transfer, and CS is driven
+//through the GPIO registers. The MCP320x needs CS high between
+//conversions, so the channels can't share one CS window.
+//The bus runs at the clock this ADC was set up with for the burst and is
+//put back after, as the SD card shares it at its own, slower, clock.
+//The sampling ISR calls this, so in SPI mode everything it runs is in
+//IRAM: the HSPI registers are driven directly rather than through the
+//SPI library, which lives in flash and would crash if the ISR fired
+//while the SDK had the flash cache off. PIN mode is not ISR safe.
+//************************************************************************
+void IRAM_ATTR AH_MCP320x::readBurst(uint16_t values[8], uint8_t mask)
+{
+   if (!_MODE){
+     	for(int i=0;i<8;i++){
+    	    if (mask & (1<<i)) values[i] = readADC_pin(i);
+     	}
+     	return;
+   }
+
+#if defined(ESP8266)
+   while(SPI1CMD & SPIBUSY) {}
+   uint32_t user1 = SPI1U1;				//the SPI library's bit length, put back after
+   uint32_t clk = SPI1CLK;				//and its clock
+   SPI1CLK = _SPI_CLK;
+   SPI1U1 = (user1 & ~((SPIMMOSI << SPILMOSI) | (SPIMMISO << SPILMISO)))
+          | ((23 << SPILMOSI) | (23 << SPILMISO));	//24 bits out and in
+
+   for(int i=0;i<8;i++){
+     if (!(mask & (1<<i))) continue;
+
+     //first byte out is the low byte of W0
+     SPI1W0 = (B00000100 | (_CONFIGURATION[i]<<1) | (i>>2))	//Start bit, config bit, channel msb
+            | (((i<<6) & 0xff) << 8);				//2 lower bits of channel number
+
+     if (_CS_MASK) GPOC = _CS_MASK; else digitalWrite(_CS, LOW);	//the core keeps digitalWrite in IRAM
+     SPI1CMD |= SPIBUSY;
+     while(SPI1CMD & SPIBUSY) {}
+     if (_CS_MASK) GPOS = _CS_MASK; else digitalWrite(_CS, HIGH);
+     uint32_t t_release = ESP.getCycleCount();	//inline, reads ccount
+
+     uint32_t rx = SPI1W0;
+     values[i] = (rx & 0x0f00) | ((rx >> 16) & 0xff);	//second byte low nibble, third byte
+     while (ESP.getCycleCount() - t_release < F_CPU / 2000000) {}	//tCSH, 500ns minimum
+   }
+
+   SPI1U1 = user1;
+   SPI1CLK = clk;
+#else
+   for(int i=0;i<8;i++){
+     if (mask & (1<<i)) values[i] = readADC_SPI(i);
+   }
+#endif
+}
+
 //************************************************************************ 
 int AH_MCP320x::readCH(int CHANNEL)
 {
@@ -24,6 +24,10 @@
 #include "WProgram.h"
 #endif
 
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
 #define SINGLE       true
 #define DIFFERENTIAL false
 
@@ -36,6 +40,7 @@ class AH_MCP320x
     AH_MCP320x(int CS, SPISettings settings);
     int readCH(int CHANNEL);
     void readALL(int values[], int n);
+    void readBurst(uint16_t values[8], uint8_t mask);
     void getCONFIG(int config[],int n);
     void setCONFIG(int CHANNEL, boolean MODE);
     void setCONFIG_allDiff(int n);
@@ -46,6 +51,8 @@ class AH_MCP320x
   private:
     int _CONFIGURATION[8];
     int _CS;
+    uint32_t _CS_MASK;
+    uint32_t _SPI_CLK;
     int _DATAOUT;
     int _DATAIN;
     int _CLK;
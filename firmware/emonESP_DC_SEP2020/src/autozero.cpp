@@ -0,0 +1,141 @@
+// emonDC automatic zero offset calibration, free to use and modify.
+
+// Once per readings interval the averaged counts of each channel come here.
+// A current channel is taken as idle when its average is below
+// autozero_idle_amps and its raw noise is low, for AUTOZERO_IDLE_INTERVALS in
+// a row. Each idle interval after that moves the overall zero and this hour's
+// zero towards the average, weighting past learning up to AUTOZERO_WEIGHT_MAX
+// intervals, so a single odd interval moves it little. The idle threshold has
+// to sit below the smallest real load, a steady load below it would be learned
+// as offset. Voltage channels are only zeroed on command, with the input shorted.
+// Learning only touches RAM, it is written to EEPROM once an hour at most.
+
+#include "autozero.h"
+#include "calibration.h"
+#include "oversample.h"
+#include "config.h"
+#include "emondc.h"
+#include "debug.h"
+
+#include <time.h>
+
+bool autozero_enabled = false;
+double autozero_idle_amps = 0.05;
+
+int32_t autozero_zero_q8[AUTOZERO_CHANNELS];
+uint8_t autozero_weight[AUTOZERO_CHANNELS];
+int32_t autozero_bin_q8[2][AUTOZERO_BINS];
+uint8_t autozero_bin_weight[2][AUTOZERO_BINS];
+
+static uint8_t autozero_idle[2] = {0, 0};  // idle intervals in a row, per current channel.
+static uint8_t autozero_command_mask = 0;  // channels being zeroed on command.
+static uint8_t autozero_command_left = 0;
+static int64_t autozero_command_sum[AUTOZERO_CHANNELS];
+static bool autozero_dirty = false;
+static unsigned long autozero_savedMillis = 0;
+
+
+// hour of the day for the bins, -1 while the time is unknown.
+static int autozero_hour(void) {
+  if (!timeConfidence) return -1;
+  return (time(nullptr) % 86400UL) / 3600;
+}
+
+void autozero_apply(void) {
+  int hour = autozero_hour();
+  for (uint8_t ch = 0; ch < AUTOZERO_CHANNELS; ch++) {
+    int32_t zero = autozero_weight[ch] ? autozero_zero_q8[ch] : 0;
+    bool current = (ch & 1) == 0;
+    if (current && hour >= 0 && autozero_bin_weight[ch / 2][hour]) zero = autozero_bin_q8[ch / 2][hour];
+    calibration_set_zero(ch, zero);
+  }
+}
+
+static void autozero_learn(int32_t &zero, uint8_t &weight, int32_t x_q8) {
+  if (weight == 0) zero = x_q8;
+  else zero += (x_q8 - zero) / (weight + 1);
+  if (weight < AUTOZERO_WEIGHT_MAX) weight++;
+}
+
+
+//-------------------------
+// On command
+//-------------------------
+void autozero_command(uint8_t mask, bool voltage) {
+  autozero_command_mask = 0;
+  if (mask & 0x01) autozero_command_mask |= voltage ? 0x03 : 0x01;
+  if (mask & 0x02) autozero_command_mask |= voltage ? 0x0C : 0x04;
+  autozero_command_left = AUTOZERO_COMMAND_INTERVALS;
+  memset(autozero_command_sum, 0, sizeof(autozero_command_sum));
+  DBUGF("autozero: command channels %02x", autozero_command_mask);
+}
+
+bool autozero_busy(void) {
+  return autozero_command_left > 0;
+}
+
+static void autozero_command_interval(const int32_t *averaged_q8) {
+  for (uint8_t ch = 0; ch < AUTOZERO_CHANNELS; ch++) {
+    if (autozero_command_mask & (1 << ch)) autozero_command_sum[ch] += averaged_q8[ch];
+  }
+  if (--autozero_command_left > 0) return;
+
+  int hour = autozero_hour();
+  for (uint8_t ch = 0; ch < AUTOZERO_CHANNELS; ch++) {
+    if (!(autozero_command_mask & (1 << ch))) continue;
+    autozero_zero_q8[ch] = autozero_command_sum[ch] / AUTOZERO_COMMAND_INTERVALS;
+    autozero_weight[ch] = AUTOZERO_WEIGHT_MAX; // measured on purpose, trusted fully.
+    Serial.print("autozero: channel "); Serial.print(ch); Serial.print(" zero_q8 "); Serial.println(autozero_zero_q8[ch]);
+    if (ch & 1) continue;
+    // the old hourly zeros may be from before whatever prompted this, start them again.
+    memset(autozero_bin_weight[ch / 2], 0, AUTOZERO_BINS);
+    if (hour >= 0) {
+      autozero_bin_q8[ch / 2][hour] = autozero_zero_q8[ch];
+      autozero_bin_weight[ch / 2][hour] = 1;
+    }
+  }
+  autozero_command_mask = 0;
+  autozero_apply();
+  config_save_autozero();
+  autozero_dirty = false;
+  autozero_savedMillis = millis();
+}
+
+
+//-------------------------
+// Idle learning
+//-------------------------
+void autozero_interval(const int32_t *averaged_q8, const double *amps) {
+  if (autozero_command_left > 0) {
+    autozero_command_interval(averaged_q8);
+    return;
+  }
+  if (!autozero_enabled) return;
+
+  int hour = autozero_hour();
+  bool learned = false;
+  for (uint8_t c = 0; c < 2; c++) {
+    uint8_t ch = c * 2;
+    bool idle = fabs(amps[c]) < autozero_idle_amps && oversample_stats[ch].noise_lsb < AUTOZERO_IDLE_NOISE_LSB;
+    if (!idle) {
+      autozero_idle[c] = 0;
+      continue;
+    }
+    if (autozero_idle[c] < AUTOZERO_IDLE_INTERVALS) {
+      autozero_idle[c]++;
+      continue;
+    }
+    autozero_learn(autozero_zero_q8[ch], autozero_weight[ch], averaged_q8[ch]);
+    if (hour >= 0) autozero_learn(autozero_bin_q8[c][hour], autozero_bin_weight[c][hour], averaged_q8[ch]);
+    learned = true;
+  }
+  if (learned) autozero_dirty = true;
+  autozero_apply(); // also moves on to the next hour's zero.
+}
+
+void autozero_loop(void) {
+  if (!autozero_dirty || millis() - autozero_savedMillis < AUTOZERO_SAVE_INTERVAL_MS) return;
+  config_save_autozero();
+  autozero_dirty = false;
+  autozero_savedMillis = millis();
+}
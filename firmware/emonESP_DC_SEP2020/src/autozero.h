@@ -0,0 +1,45 @@
+// emonDC automatic zero offset calibration, free to use and modify.
+
+#ifndef _EMONDC_AUTOZERO_H
+#define _EMONDC_AUTOZERO_H
+
+#include <Arduino.h>
+
+// The zero of each channel is learned in ADC counts (Q8, reference removed),
+// on top of the AmpOffset/VoltOffset from the config. Current channel zeros
+// are kept per hour of the day, the amplifier offset drifts with temperature
+// and that mostly follows the daily cycle, with one overall zero used for
+// hours not learned yet and while the time is unknown.
+#define AUTOZERO_CHANNELS       4   // A current, A voltage, B current, B voltage.
+#define AUTOZERO_BINS           24
+// consecutive quiet intervals before one is learned from, so the tail of a load is not.
+#define AUTOZERO_IDLE_INTERVALS 6
+// raw noise, rms LSB, above which the channel is not idle whatever its average.
+#define AUTOZERO_IDLE_NOISE_LSB 3.0
+// intervals averaged for a /calibrate/zero command.
+#define AUTOZERO_COMMAND_INTERVALS 3
+// the weight of past learning tops out here, newer intervals count 1/AUTOZERO_WEIGHT_MAX.
+#define AUTOZERO_WEIGHT_MAX     16
+#define AUTOZERO_SAVE_INTERVAL_MS 3600000UL
+
+extern bool autozero_enabled;           // learn current zeros from idle periods.
+extern double autozero_idle_amps;       // below this a current channel may be idle.
+
+// Learned zeros, saved by config_save_autozero, a weight of 0 is not learned.
+extern int32_t autozero_zero_q8[AUTOZERO_CHANNELS];
+extern uint8_t autozero_weight[AUTOZERO_CHANNELS];
+extern int32_t autozero_bin_q8[2][AUTOZERO_BINS];  // current A, current B.
+extern uint8_t autozero_bin_weight[2][AUTOZERO_BINS];
+
+// Put the zeros for this hour into the calibration, after they are loaded.
+void autozero_apply(void);
+// Zero the current channels (and the voltage channels with voltage set) from
+// the next few intervals, the inputs must be at zero. mask: bit 0 A, bit 1 B.
+void autozero_command(uint8_t mask, bool voltage);
+bool autozero_busy(void);
+// Learn from the interval just averaged, counts in Q8 with the reference removed.
+void autozero_interval(const int32_t *averaged_q8, const double *amps);
+// Save what was learned when it is due.
+void autozero_loop(void);
+
+#endif // _EMONDC_AUTOZERO_H
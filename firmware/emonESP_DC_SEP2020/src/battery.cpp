@@ -0,0 +1,189 @@
+// emonDC battery model, free to use and modify.
+
+// The model is kept to pure functions of the battery settings and the
+// current, so the live state of charge in average_and_calibrate() and the
+// host replay of the logs, battery_replay.cpp, run the very same code. The
+// ESP8266 has no FPU and a double pow() is a few thousand cycles, so the
+// Peukert capacity is worked out once per settings change and I^n is done in
+// float, its error is far below that of the current measured.
+// The estimator on top, battery_estimate(), only adds the voltage and the
+// time, which the logs have too, so a replay also shows what the full and
+// rested voltage corrections would have done.
+
+#include "battery.h"
+#include "emondc.h"
+
+// Rested voltages from makers' tables, a few hours after charge or discharge.
+// The charge efficiencies are the usual starting points for a battery monitor.
+// Check the battery maker's instructions and the charger's modes for what full looks like.
+// https://batteryuniversity.com/learn/article/charging_the_lead_acid_battery
+const battery_profile_t battery_profiles[BATTERY_TYPES] = {
+  {"coulomb counting", 2.0, 1.00, 0, 0, 0, 0, 0, 0, {0}},
+  {"flooded lead-acid", 2.0, 0.95, 2.30, 0.02, 30, 0.005, 120, 0.010,
+   {1.917, 1.940, 1.960, 1.980, 1.997, 2.020, 2.040, 2.060, 2.077, 2.097, 2.117}},
+  {"gel/AGM lead-acid", 2.0, 0.95, 2.30, 0.01, 30, 0.005, 120, 0.010,
+   {1.950, 1.967, 1.983, 2.000, 2.017, 2.033, 2.053, 2.073, 2.093, 2.117, 2.142}},
+  // the middle of the curve is flat, the rested voltage counts for little there.
+  {"lithium iron phosphate", 3.0, 0.99, 3.45, 0.04, 10, 0.005, 60, 0.010,
+   {2.500, 3.000, 3.200, 3.220, 3.250, 3.260, 3.270, 3.300, 3.320, 3.350, 3.400}},
+};
+
+battery_params_t battery_config;
+battery_state_t battery_state = {BATTERY_UNCERTAINTY_UNKNOWN, 0, 0, 0, 0, 0};
+
+void battery_prepare(battery_params_t &p) {
+  // the one pow() left, only when the settings change.
+  p.peukert_capacity = p.cap_hr * pow(p.capacity / p.cap_hr, p.peukert);
+  p.profile = &battery_profiles[p.type < BATTERY_TYPES ? p.type : 0];
+  p.cells = max(1.0f, roundf(p.nominal_volts / p.profile->cell_volts));
+}
+
+void battery_configure(void) {
+  battery_config.capacity = BattCapacity;
+  battery_config.cap_hr = BattCapHr;
+  battery_config.peukert = BattPeukert;
+  battery_config.type = BattType;
+  battery_config.nominal_volts = BattNom;
+  battery_prepare(battery_config);
+}
+
+
+//-------------------------
+// Model
+//-------------------------
+float battery_pow(float x, float n) {
+  // log2 x: split x into 2^e x m with m in [0.707, 1.414), then
+  // log2 m = 2/ln2 (t + t^3/3 + t^5/5 + t^7/7) with t = (m - 1)/(m + 1), |t| < 0.172.
+  union { float f; uint32_t u; } v = {x};
+  int32_t e = (int32_t)((v.u >> 23) & 0xFF) - 127;
+  v.u = (v.u & 0x007FFFFF) | 0x3F800000;
+  if (v.f > 1.41421356f) { v.f *= 0.5f; e++; }
+  float t = (v.f - 1.0f) / (v.f + 1.0f);
+  float t2 = t * t;
+  float y = n * (e + t * (2.88539008f + t2 * (0.96179669f + t2 * (0.57707801f + t2 * 0.41219858f))));
+
+  // 2^y: whole part into the exponent, 2^f for f in [-0.5, 0.5] by its series to f^6.
+  float whole = floorf(y + 0.5f);
+  float f = (y - whole) * 0.69314718f;
+  float r = 1.0f + f * (1.0f + f * (0.5f + f * (1.66666667e-1f + f * (4.16666667e-2f + f * (8.33333333e-3f + f * 1.38888889e-3f)))));
+  if (whole < -126) return 0;
+  if (whole > 127) return INFINITY;
+  v.f = r;
+  v.u += (uint32_t)(int32_t)whole << 23; // shifted unsigned, a negative int shifted is undefined.
+  return v.f;
+}
+
+double battery_hours_from_full(const battery_params_t &p, double amps) {
+  // http://www.smartgauge.co.uk/peukert2.html
+  // T = (Hr*(C/Hr)^n)/(I^n)
+  float current = max((float)fabs(amps), BATTERY_AMPS_MIN);
+  double hours = p.peukert_capacity / battery_pow(current, p.peukert);
+  return amps < 0 ? -hours : hours;
+}
+
+double battery_effective_capacity(const battery_params_t &p, double amps) {
+  // http://www.smartgauge.co.uk/peukert3.html
+  // T x I, one power rather than T's and then x I.
+  float current = max((float)fabs(amps), BATTERY_AMPS_MIN);
+  return p.peukert_capacity * battery_pow(current, 1.0f - p.peukert);
+}
+
+double battery_soc_step(const battery_params_t &p, double soc, double amps, double Ah_period) {
+  soc += Ah_period / battery_effective_capacity(p, amps);
+  if (soc > 1.0) soc = 1.0;
+  // C *= state_of_charge; don't adjust this on the fly because of it's effect of peukert equation.
+  return soc;
+}
+
+
+
+battery_bench_t battery_benchmark(void) {
+  battery_bench_t bench = {0, 0, 0};
+  const battery_params_t &p = battery_config;
+  const uint8_t steps = 64;
+  volatile double sink = 0; // keeps the results from being optimised away.
+  for (uint8_t i = 0; i < steps; i++) {
+    double amps = -0.01 * pow(30000.0, i / (double)(steps - 1)); // discharging, 10 mA to 300 A.
+
+    uint32_t start = ESP.getCycleCount();
+    double fast = battery_effective_capacity(p, amps);
+    sink = sink + battery_hours_from_full(p, amps);
+    bench.fast_cycles += ESP.getCycleCount() - start;
+
+    // as it was: T from both powers each call, once for the state of charge and once for time to go.
+    start = ESP.getCycleCount();
+    double T = p.cap_hr * pow(p.capacity / p.cap_hr, p.peukert) / pow(fabs(amps), p.peukert);
+    double slow = T * fabs(amps);
+    sink = sink + p.cap_hr * pow(p.capacity / p.cap_hr, p.peukert) / pow(fabs(amps), p.peukert);
+    bench.pow_cycles += ESP.getCycleCount() - start;
+
+    float error = fabs(fast - slow) / slow;
+    if (error > bench.max_error) bench.max_error = error;
+  }
+  bench.fast_cycles /= steps;
+  bench.pow_cycles /= steps;
+  return bench;
+}
+
+
+//-------------------------
+// Estimator
+//-------------------------
+float battery_ocv_soc(const battery_params_t &p, double volts) {
+  const float *ocv = p.profile->ocv;
+  if (ocv[BATTERY_OCV_POINTS - 1] == 0) return -1;
+  float cell = volts / p.cells;
+  if (cell <= ocv[0]) return 0;
+  if (cell >= ocv[BATTERY_OCV_POINTS - 1]) return 1;
+  uint8_t i = 1;
+  while (cell > ocv[i]) i++;
+  return (i - 1 + (cell - ocv[i - 1]) / (ocv[i] - ocv[i - 1])) / (BATTERY_OCV_POINTS - 1);
+}
+
+// How far out a rested voltage reading puts the state of charge, from the slope of the table there.
+static float battery_ocv_uncertainty(const battery_params_t &p, double volts) {
+  const float *ocv = p.profile->ocv;
+  float cell = constrain((float)(volts / p.cells), ocv[0], ocv[BATTERY_OCV_POINTS - 1]);
+  uint8_t i = 1;
+  while (i < BATTERY_OCV_POINTS - 1 && cell > ocv[i]) i++;
+  float soc_per_volt = (1.0f / (BATTERY_OCV_POINTS - 1)) / max(ocv[i] - ocv[i - 1], 0.001f);
+  return min(1.0f, p.profile->ocv_error * soc_per_volt);
+}
+
+double battery_estimate(const battery_params_t &p, battery_state_t &s, double soc,
+                        double amps, double volts, double Ah_period, uint32_t seconds) {
+  const battery_profile_t &b = *p.profile;
+  if (Ah_period > 0) Ah_period *= b.charge_efficiency;
+  soc = battery_soc_step(p, soc, amps, Ah_period);
+  if (soc < 0) soc = 0;
+  s.uncertainty = min(1.0f, s.uncertainty + (float)(fabs(Ah_period) / p.capacity) * BATTERY_COUNT_ERROR);
+
+  // full: the charger has held the voltage up while the current tailed off.
+  bool full = b.full_minutes > 0 && volts >= b.full_volts * p.cells && fabs(amps) <= b.full_amps_c * p.capacity;
+  s.full_s = full ? s.full_s + seconds : 0;
+  if (full && s.full_s >= b.full_minutes * 60UL) {
+    if (s.full_s - seconds < b.full_minutes * 60UL) s.fulls++;
+    soc = 1.0;
+    s.uncertainty = 0;
+  }
+
+  // rest: the voltage has settled towards the open circuit voltage. A weighted
+  // average of the two by their uncertainties, a one state Kalman update.
+  bool rest = b.rest_minutes > 0 && !full && fabs(amps) <= b.rest_amps_c * p.capacity;
+  s.rest_s = rest ? s.rest_s + seconds : 0;
+  if (!rest) s.ocv_next_s = 0;
+  else if (s.ocv_next_s == 0) s.ocv_next_s = b.rest_minutes * 60UL;
+  if (rest && s.rest_s >= s.ocv_next_s) {
+    float ocv_soc = battery_ocv_soc(p, volts);
+    float e = battery_ocv_uncertainty(p, volts);
+    float u = s.uncertainty;
+    if (u + e > 0) {
+      float w = u * u / (u * u + e * e);
+      soc += w * (ocv_soc - soc);
+      s.uncertainty = u * e / sqrtf(u * u + e * e);
+    }
+    s.ocv_corrections++;
+    s.ocv_next_s = s.rest_s + BATTERY_OCV_REPEAT_S;
+  }
+  return soc;
+}
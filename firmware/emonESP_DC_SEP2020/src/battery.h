@@ -0,0 +1,107 @@
+// emonDC battery model, free to use and modify.
+
+#ifndef _EMONDC_BATTERY_H
+#define _EMONDC_BATTERY_H
+
+#include <Arduino.h>
+
+// Rested voltage table points, 0 to 100% state of charge in 10% steps.
+#define BATTERY_OCV_POINTS 11
+#define BATTERY_TYPES 4
+
+// What the state of charge estimator needs to know of a kind of battery,
+// picked by BattType: 0 coulomb counting only, 1 flooded lead-acid, 2 gel or
+// AGM lead-acid, 3 lithium iron phosphate. Voltages are per cell.
+struct battery_profile_t {
+  const char *name;
+  float cell_volts;         // nominal, BattNom / this is the number of cells.
+  float charge_efficiency;  // Ah stored per Ah in.
+  float full_volts;         // full when held at or above this,
+  float full_amps_c;        // with the current within this fraction of the capacity,
+  uint16_t full_minutes;    // for this long.
+  float rest_amps_c;        // at rest with the current within this,
+  uint16_t rest_minutes;    // for this long, the voltage is then the open circuit voltage.
+  float ocv_error;          // volts, how far a rested voltage is from settled.
+  float ocv[BATTERY_OCV_POINTS]; // rested volts at 0, 10 ... 100%, all 0 for none.
+};
+
+extern const battery_profile_t battery_profiles[BATTERY_TYPES];
+
+// The battery on channel B, as set on the config page.
+struct battery_params_t {
+  double capacity;   // Ah at the rated hours.
+  uint16_t cap_hr;   // rated hours, normally 20.
+  double peukert;    // Peukert exponent, 1.0 for an ideal battery.
+  uint16_t type;     // BattType, see battery_profile_t.
+  float nominal_volts;
+  // filled in by battery_prepare().
+  float peukert_capacity; // Hr*(C/Hr)^n.
+  const battery_profile_t *profile;
+  float cells;
+};
+
+// Currents below this are taken as this, Peukert's law runs off to infinity at 0.
+#define BATTERY_AMPS_MIN 0.001f
+
+// The configured battery, as of the last battery_configure().
+extern battery_params_t battery_config;
+inline const battery_params_t &battery_params(void) { return battery_config; }
+// Take up changed battery settings, after loading or saving the config.
+void battery_configure(void);
+// Work out the parts of p that only change with the settings.
+void battery_prepare(battery_params_t &p);
+
+// x^n for x > 0, as 2^(n log2 x) with short polynomials in float, about
+// 1e-6 relative error against pow() at a fraction of the time on the ESP8266.
+float battery_pow(float x, float n);
+
+// Hours to discharge from full at amps, by Peukert's law, negative while charging.
+double battery_hours_from_full(const battery_params_t &p, double amps);
+// Ah available from full at amps, the rated capacity derated for the current.
+double battery_effective_capacity(const battery_params_t &p, double amps);
+// State of charge after Ah_period flowed in (negative out) at an average of amps.
+double battery_soc_step(const battery_params_t &p, double soc, double amps, double Ah_period);
+
+// State of charge estimator. Coulomb counting, less the charge efficiency,
+// pulled back towards the rested voltage after a rest and set to full when
+// the charger has held the battery full. Alongside the state of charge it
+// keeps an estimate of how far out it may be, growing with the charge
+// counted and shrinking with each correction; the confidence is 1 less that.
+struct battery_state_t {
+  float uncertainty;        // of the state of charge, 0 to 1.
+  uint32_t full_s;          // the full condition has held this long.
+  uint32_t rest_s;          // at rest this long.
+  uint32_t ocv_next_s;      // rest_s at which to take the rested voltage next.
+  uint32_t fulls;           // corrections since boot or the replay began.
+  uint32_t ocv_corrections;
+};
+
+// uncertainty with nothing known, after a power on with no saved state.
+#define BATTERY_UNCERTAINTY_UNKNOWN 0.5f
+// uncertainty added per Ah counted, as a fraction of the capacity.
+#define BATTERY_COUNT_ERROR 0.02f
+// while resting, the rested voltage is taken again this often.
+#define BATTERY_OCV_REPEAT_S 3600UL
+
+extern battery_state_t battery_state;
+
+// soc after an interval of seconds with Ah_period in at an average of amps,
+// and volts across the battery at the end of it. s is moved on too.
+double battery_estimate(const battery_params_t &p, battery_state_t &s, double soc,
+                        double amps, double volts, double Ah_period, uint32_t seconds);
+// State of charge for a rested voltage, -1 when the battery type has no table.
+float battery_ocv_soc(const battery_params_t &p, double volts);
+inline float battery_confidence(const battery_state_t &s) { return 1.0f - s.uncertainty; }
+
+// CPU cycles per state of charge step the model takes, against the double
+// pow() it used to make four calls to, and the worst relative difference in
+// the effective capacity, over currents from 10 mA to 300 A. About 10 ms at
+// 160 MHz and it does not yield, so it can run in a web server callback.
+struct battery_bench_t {
+  uint32_t fast_cycles;
+  uint32_t pow_cycles;
+  float max_error;
+};
+battery_bench_t battery_benchmark(void);
+
+#endif // _EMONDC_BATTERY_H
@@ -0,0 +1,344 @@
+// emonDC battery log replay, free to use and modify.
+
+// Replays logs taken off the SD card through the battery model on the host,
+// to see what other battery settings would have made of the state of charge
+// without waiting days for field results. pio run -e replay, then
+//   .pio/build/replay/program [options] 2020-09-01.bin 2020-09-02.bin ...
+// The logs are the binary ones as downloaded from /sd/, CSV from /sd/export,
+// or the key:value lines save_to_SDcard() wrote to yyyy-mm-dd.csv before the
+// binary log, given in time order. Columns are found by name, so a log of an
+// older schema works as long as it has the ones used.
+//   --type n       BattType, see battery_profile_t.
+//   --capacity Ah  --caphr hours  --peukert n  --nominal volts
+//   --soc %        where to start, the first logged state of charge if not given.
+//   --every rows   rows per trajectory point, default 60.
+//   --gap seconds  rows further apart are a gap where there are no Ah totals, default 300.
+// Settings not given are those a fresh board boots with. The trajectory goes
+// to stdout as CSV: time, replayed %, logged %, confidence %; the summary,
+// with the error against the logged state of charge and the rows replayed
+// per second, to stderr.
+// Each row steps the state of charge once, with the charge taken from the
+// difference of the logged Ah totals, as integrated per sample, and the
+// Peukert current from the row's average. Where the totals went backwards,
+// power lost before the hourly save, the row's charge is not known and it is
+// counted as a gap. Logs without the totals, the key:value ones, have the
+// charge from the row's average current over the time since the row before.
+// The logged state of charge is what the settings of the day produced.
+
+#if defined(EMONDC_NATIVE) && defined(EMONDC_REPLAY)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "battery.h"
+#include "emondc.h"
+#include "measurement.h"
+#include "sdlog.h"
+
+#define REPLAY_LINE_SIZE 1024
+// a key:value line's time, rtcTime, or runTime where the RTC was not trusted.
+#define REPLAY_TIME -2
+// columns, the time's too on key:value lines.
+#define REPLAY_COLUMNS (MEAS_FIELDS + 1)
+
+// the columns the replay needs, and the Ah totals it uses where a log has them.
+static const meas_field_t replay_fields[] = {MEAS_SOC, MEAS_AMPS_B, MEAS_VOLTS_B};
+static const meas_field_t replay_totals[] = {MEAS_AH_IN_B, MEAS_AH_OUT_B};
+
+enum replay_format_t { REPLAY_BINARY, REPLAY_CSV, REPLAY_KEYVALUE };
+
+struct replay_log_t {
+  FILE *file;
+  replay_format_t format;
+  bool totals;                   // has the Ah totals.
+  uint16_t columns;              // after the time; key:value lines, the keys so far.
+  int8_t field[REPLAY_COLUMNS];  // measurement field of each column, -1 for one not known or used.
+  double scale[MEAS_FIELDS];     // 10^exponent, binary logs.
+  uint16_t row_size;
+  uint8_t block[SDLOG_BLOCK_SIZE];
+  uint16_t rows, row;
+};
+
+struct replay_row_t {
+  uint32_t time;
+  double value[MEAS_FIELDS];
+};
+
+static bool replay_uses(int8_t field) {
+  for (meas_field_t used : replay_fields) if (field == used) return true;
+  for (meas_field_t used : replay_totals) if (field == used) return true;
+  return false;
+}
+
+static bool replay_is(const char *known, const char *name, size_t len) {
+  return strncmp(known, name, len) == 0 && known[len] == 0;
+}
+
+static int8_t replay_field_named(const char *name, size_t len) {
+  for (uint8_t f = 0; f < MEAS_FIELDS; f++) {
+    if (replay_is(measurement_name((meas_field_t)f), name, len)) return f;
+  }
+  return -1;
+}
+
+static bool replay_has(const replay_log_t &log, meas_field_t needed) {
+  for (uint16_t c = 0; c < log.columns; c++) {
+    if (log.field[c] == needed) return true;
+  }
+  return false;
+}
+
+static bool replay_has_fields(replay_log_t &log) {
+  for (meas_field_t needed : replay_fields) {
+    if (!replay_has(log, needed)) {
+      fprintf(stderr, "no %s column\n", measurement_name(needed));
+      return false;
+    }
+  }
+  log.totals = true;
+  for (meas_field_t total : replay_totals) log.totals &= replay_has(log, total);
+  return true;
+}
+
+static bool replay_open_binary(replay_log_t &log) {
+  sdlog_header_t *header = (sdlog_header_t *)log.block;
+  if (fread(log.block, 1, SDLOG_BLOCK_SIZE, log.file) != SDLOG_BLOCK_SIZE
+      || memcmp(header->magic, SDLOG_MAGIC, sizeof(SDLOG_MAGIC)) != 0
+      || header->field_count > MEAS_FIELDS
+      || header->row_size < sizeof(uint32_t) + header->field_count * sizeof(int32_t)) {
+    return false;
+  }
+  log.columns = header->field_count;
+  log.row_size = header->row_size;
+  for (uint16_t c = 0; c < log.columns; c++) {
+    log.field[c] = replay_field_named(header->field[c].name, strnlen(header->field[c].name, SDLOG_NAME_SIZE));
+    log.scale[c] = pow(10.0, header->field[c].exponent);
+  }
+  log.rows = 0;
+  log.row = 0;
+  return true;
+}
+
+static bool replay_open_csv(replay_log_t &log, char *line) {
+  log.columns = 0;
+  char *name = line + 5;
+  while (*name && log.columns < MEAS_FIELDS) {
+    size_t len = strcspn(name, ",\r\n");
+    int8_t field = replay_field_named(name, len);
+    log.field[log.columns++] = replay_uses(field) ? field : -1;
+    name += len;
+    if (*name != ',') break;
+    name++;
+  }
+  return true;
+}
+
+// One key:value line, as save_to_SDcard() and measurement_format() write
+// them. The keys come in the same order on every line, so each column's is
+// checked against the one the line before had there, and only looked up when
+// it differs. False for a line without a time.
+static bool replay_parse_keyvalue(replay_log_t &log, char *line, replay_row_t &r) {
+  bool timed = false;
+  char *p = line;
+  for (uint16_t c = 0; *p && *p != '\r' && *p != '\n'; c++) {
+    char *colon = strchr(p, ':');
+    if (!colon) break;
+    size_t len = colon - p;
+    int8_t field = c < log.columns ? log.field[c] : -1;
+    bool same = field == REPLAY_TIME ? replay_is("rtcTime", p, len) || replay_is("runTime", p, len)
+              : field >= 0 && replay_is(measurement_name((meas_field_t)field), p, len);
+    if (!same) {
+      field = replay_is("rtcTime", p, len) || replay_is("runTime", p, len) ? REPLAY_TIME : replay_field_named(p, len);
+      if (c < REPLAY_COLUMNS) {
+        log.field[c] = field;
+        if (c >= log.columns) log.columns = c + 1;
+      }
+    }
+    p = colon + 1;
+    if (field == REPLAY_TIME) {
+      r.time = strtoul(p, &p, 10);
+      timed = true;
+    } else if (replay_uses(field)) {
+      r.value[field] = strtod(p, &p);
+    }
+    p += strcspn(p, ",\r\n");
+    if (*p == ',') p++;
+  }
+  return timed;
+}
+
+// the columns are what the first line has, it is read again as the first row.
+static bool replay_open_keyvalue(replay_log_t &log, char *line) {
+  replay_row_t r;
+  log.columns = 0;
+  if (!replay_parse_keyvalue(log, line, r)) return false;
+  rewind(log.file);
+  return true;
+}
+
+static bool replay_open(replay_log_t &log, const char *path) {
+  log.file = fopen(path, "rb");
+  if (!log.file) return false;
+  setvbuf(log.file, NULL, _IOFBF, 1 << 16);
+  char line[REPLAY_LINE_SIZE];
+  bool opened;
+  if (fread(line, 1, sizeof(SDLOG_MAGIC), log.file) == sizeof(SDLOG_MAGIC) && memcmp(line, SDLOG_MAGIC, sizeof(SDLOG_MAGIC)) == 0) {
+    log.format = REPLAY_BINARY;
+    rewind(log.file);
+    opened = replay_open_binary(log);
+  } else {
+    rewind(log.file);
+    opened = fgets(line, sizeof(line), log.file) != NULL;
+    log.format = strncmp(line, "time,", 5) == 0 ? REPLAY_CSV : REPLAY_KEYVALUE;
+    if (opened) opened = log.format == REPLAY_CSV ? replay_open_csv(log, line) : replay_open_keyvalue(log, line);
+  }
+  if (opened && replay_has_fields(log)) return true;
+  fclose(log.file);
+  return false;
+}
+
+static bool replay_read(replay_log_t &log, replay_row_t &r) {
+  if (log.format == REPLAY_KEYVALUE) {
+    char line[REPLAY_LINE_SIZE];
+    while (fgets(line, sizeof(line), log.file)) {
+      if (replay_parse_keyvalue(log, line, r)) return true;
+    }
+    return false;
+  }
+
+  if (log.format == REPLAY_CSV) {
+    char line[REPLAY_LINE_SIZE];
+    if (!fgets(line, sizeof(line), log.file)) return false;
+    char *p = line;
+    r.time = strtoul(p, &p, 10);
+    for (uint16_t c = 0; c < log.columns && *p == ','; c++) {
+      p++;
+      if (log.field[c] >= 0) r.value[log.field[c]] = strtod(p, &p);
+      p += strcspn(p, ",\r\n");
+    }
+    return true;
+  }
+
+  while (log.row >= log.rows) {
+    if (fread(log.block, 1, SDLOG_BLOCK_SIZE, log.file) != SDLOG_BLOCK_SIZE) return false;
+    sdlog_block_header_t *block_header = (sdlog_block_header_t *)log.block;
+    if (block_header->row_size != log.row_size) return false;
+    if (sizeof(sdlog_block_header_t) + block_header->rows * log.row_size > SDLOG_BLOCK_SIZE) return false;
+    log.rows = block_header->rows;
+    log.row = 0;
+  }
+  const uint8_t *row = log.block + sizeof(sdlog_block_header_t) + log.row++ * log.row_size;
+  memcpy(&r.time, row, sizeof(r.time));
+  for (uint16_t c = 0; c < log.columns; c++) {
+    int32_t value;
+    memcpy(&value, row + sizeof(r.time) + c * sizeof(value), sizeof(value));
+    if (log.field[c] >= 0) r.value[log.field[c]] = value * log.scale[c];
+  }
+  return true;
+}
+
+static void replay_usage(void) {
+  fprintf(stderr, "usage: program [--type n] [--capacity Ah] [--caphr hours] [--peukert n] [--nominal volts]\n"
+                  "               [--soc %%] [--every rows] [--gap seconds] log.bin|log.csv ...\n");
+}
+
+int main(int argc, char **argv) {
+  battery_configure(); // the defaults a fresh board has.
+  battery_params_t p = battery_params();
+  double soc = -1;
+  unsigned long every = 60;
+  unsigned long gap = 300;
+
+  int arg = 1;
+  for (; arg + 1 < argc && strncmp(argv[arg], "--", 2) == 0; arg += 2) {
+    const char *option = argv[arg] + 2;
+    double value = atof(argv[arg + 1]);
+    if (!strcmp(option, "type")) p.type = value;
+    else if (!strcmp(option, "capacity")) p.capacity = value;
+    else if (!strcmp(option, "caphr")) p.cap_hr = value;
+    else if (!strcmp(option, "peukert")) p.peukert = value;
+    else if (!strcmp(option, "nominal")) p.nominal_volts = value;
+    else if (!strcmp(option, "soc")) soc = value / 100.0;
+    else if (!strcmp(option, "every")) every = max(1.0, value);
+    else if (!strcmp(option, "gap")) gap = value;
+    else {
+      replay_usage();
+      return 2;
+    }
+  }
+  if (arg >= argc) {
+    replay_usage();
+    return 2;
+  }
+  if (p.capacity <= 0 || p.cap_hr == 0 || p.peukert <= 0) {
+    fprintf(stderr, "capacity, caphr and peukert must be above 0\n");
+    return 2;
+  }
+  battery_prepare(p);
+
+  battery_state_t state = {BATTERY_UNCERTAINTY_UNKNOWN, 0, 0, 0, 0, 0};
+  bool have_row = false, have_totals = false;
+  double Ah_in = 0, Ah_out = 0;
+  uint32_t time = 0;
+  uint64_t start_ns = hal_host_ns();
+  unsigned long files = 0, rows = 0, gaps = 0;
+  double soc_min = 1.0, error_squares = 0, error_max = 0;
+
+  printf("time,soc,logged_soc,confidence\n");
+  for (; arg < argc; arg++) {
+    replay_log_t log;
+    if (!replay_open(log, argv[arg])) {
+      fprintf(stderr, "%s: not an emonDC log\n", argv[arg]);
+      return 1;
+    }
+    files++;
+    replay_row_t r;
+    memset(&r, 0, sizeof(r));
+    while (replay_read(log, r)) {
+      double logged = r.value[MEAS_SOC] / 100.0;
+      if (soc < 0) soc = logged;
+      if (have_row) {
+        uint32_t seconds = r.time - time;
+        bool totals = log.totals && have_totals;
+        double in = r.value[MEAS_AH_IN_B] - Ah_in;
+        double out = r.value[MEAS_AH_OUT_B] - Ah_out;
+        if (r.time < time || (totals ? in < 0 || out < 0 : seconds > gap)) {
+          gaps++;
+        } else {
+          // without the totals, the row's average current since the row before.
+          double Ah = totals ? in - out : r.value[MEAS_AMPS_B] * seconds / 3600.0;
+          soc = battery_estimate(p, state, soc, r.value[MEAS_AMPS_B], r.value[MEAS_VOLTS_B], Ah, seconds);
+        }
+      }
+      Ah_in = r.value[MEAS_AH_IN_B];
+      Ah_out = r.value[MEAS_AH_OUT_B];
+      time = r.time;
+      have_row = true;
+      have_totals = log.totals;
+
+      if (soc < soc_min) soc_min = soc;
+      double error = soc - logged;
+      error_squares += error * error;
+      if (fabs(error) > error_max) error_max = fabs(error);
+      if (rows++ % every == 0) {
+        printf("%lu,%.2f,%.2f,%.1f\n", (unsigned long)r.time, soc * 100, logged * 100, battery_confidence(state) * 100);
+      }
+    }
+    fclose(log.file);
+  }
+  double seconds = (hal_host_ns() - start_ns) / 1e9;
+
+  fprintf(stderr, "type %u (%s), capacity %.2f Ah at %u h, peukert %.3f, %.0f cells\n",
+          p.type, p.profile->name, p.capacity, p.cap_hr, p.peukert, p.cells);
+  fprintf(stderr, "files %lu, rows %lu, gaps %lu, fulls %lu, ocv corrections %lu\n",
+          files, rows, gaps, (unsigned long)state.fulls, (unsigned long)state.ocv_corrections);
+  fprintf(stderr, "%lu rows in %.3f s, %.0f rows/s\n", rows, seconds, seconds > 0 ? rows / seconds : 0);
+  fprintf(stderr, "final soc %.2f%%, confidence %.1f%%, min soc %.2f%%, rms error %.2f%%, max error %.2f%%\n",
+          soc < 0 ? 0 : soc * 100, battery_confidence(state) * 100, soc_min * 100,
+          rows ? sqrt(error_squares / rows) * 100 : 0, error_max * 100);
+  return 0;
+}
+
+#endif // EMONDC_NATIVE && EMONDC_REPLAY
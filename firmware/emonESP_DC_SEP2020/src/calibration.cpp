@@ -0,0 +1,152 @@
+// emonDC fixed-point calibration, free to use and modify.
+
+// The ESP8266 has no FPU, so the per-interval conversion from ADC counts to
+// volts and amps is done with 64-bit integer multiply-shift. The divider
+// ratio, shunt, gain and ical/vcal terms only change when the config does.
+//
+//   Volts = (counts * 3.3/VREF33 * (R1+R2)/R2 + VoltOffset) * vcal
+//   Amps  = (counts * 3.3/VREF33 / (gain*Rshunt) + AmpOffset) * ical
+//
+// The correction points add a piecewise linear term, one segment per gap
+// between points plus the two held ends. Each segment is a slope and
+// intercept worked out when the points change, found by binary search on the
+// counts, so a reading costs the same however many points there are.
+
+#include "calibration.h"
+#include "emondc.h"
+
+#define CAL_VREF33_VOLTS 3.3
+
+cal_channel_t cal_channels[CAL_CHANNELS];
+static int32_t cal_vref33_q8 = 0; // last good VREF33 reading, for recompiling.
+
+cal_point_t cal_points[CAL_POINT_CHANNELS][CAL_POINTS];
+uint8_t cal_point_count[CAL_POINT_CHANNELS] = {0, 0, 0, 0};
+
+// segment k covers counts from point k-1 up to point k, 0 and count are the held ends.
+struct cal_segment_t {
+  int64_t slope_q16;    // micro-units per count Q8, Q16.
+  int32_t intercept_u;
+};
+static cal_segment_t cal_segments[CAL_POINT_CHANNELS][CAL_POINTS + 1];
+
+static void calibration_compile_points(uint8_t channel) {
+  const cal_point_t *p = cal_points[channel];
+  cal_segment_t *seg = cal_segments[channel];
+  uint8_t n = cal_point_count[channel];
+  if (n == 0) return;
+  seg[0].slope_q16 = 0;
+  seg[0].intercept_u = p[0].correction_u;
+  for (uint8_t k = 1; k < n; k++) {
+    int64_t dx = (int64_t)p[k].counts_q8 - p[k - 1].counts_q8;
+    seg[k].slope_q16 = (((int64_t)p[k].correction_u - p[k - 1].correction_u) * 65536) / dx;
+    seg[k].intercept_u = p[k - 1].correction_u - (int32_t)(((int64_t)p[k - 1].counts_q8 * seg[k].slope_q16) >> 16);
+  }
+  seg[n].slope_q16 = 0;
+  seg[n].intercept_u = p[n - 1].correction_u;
+}
+
+static int32_t calibration_correction(uint8_t channel, int32_t counts_q8) {
+  const cal_point_t *p = cal_points[channel];
+  // segment = number of points at or below the counts.
+  uint8_t lo = 0, hi = cal_point_count[channel];
+  while (lo < hi) {
+    uint8_t mid = (lo + hi) >> 1;
+    if (p[mid].counts_q8 <= counts_q8) lo = mid + 1;
+    else hi = mid;
+  }
+  const cal_segment_t &seg = cal_segments[channel][lo];
+  return seg.intercept_u + (int32_t)(((int64_t)counts_q8 * seg.slope_q16) >> 16);
+}
+
+static int64_t calibration_linear(const cal_channel_t &cal, int32_t counts_q8) {
+  return (((int64_t)counts_q8 * cal.scale_q16 + (1LL << 23)) >> 24) + cal.offset_u;
+}
+
+static void calibration_compile_channel(uint8_t channel, double k, double offset) {
+  cal_channels[channel].coeff_q16 = llround(k * CAL_VREF33_VOLTS * 1e6 * 65536.0);
+  cal_channels[channel].base_offset_u = lround(offset * 1e6);
+  cal_channels[channel].offset_u = cal_channels[channel].base_offset_u;
+  cal_channels[channel].scale_q16 = 0;
+}
+
+static void calibration_fold_zero(cal_channel_t &cal) {
+  cal.offset_u = cal.base_offset_u - (int32_t)(((int64_t)cal.zero_q8 * cal.scale_q16 + (1LL << 23)) >> 24);
+}
+
+void calibration_compile(void) {
+  double divider_A = ((double)R1_A + (double)R2_A) / (double)R2_A;
+  double divider_B = ((double)R1_B + (double)R2_B) / (double)R2_B;
+
+  calibration_compile_channel(CAL_CURRENT_A, icalA / (channelA_gain * Rshunt_A), AmpOffset_A * icalA);
+  calibration_compile_channel(CAL_VOLTAGE_A, vcalA * divider_A, VoltOffset_A * vcalA);
+  calibration_compile_channel(CAL_CURRENT_B, icalB / (channelB_gain * Rshunt_B), AmpOffset_B * icalB);
+  calibration_compile_channel(CAL_VOLTAGE_B, vcalB * divider_B, VoltOffset_B * vcalB);
+  calibration_compile_channel(CAL_REF, 1.0, 0.0);
+  for (uint8_t c = 0; c < CAL_POINT_CHANNELS; c++) calibration_compile_points(c);
+  if (cal_vref33_q8 > 0) calibration_set_vref(cal_vref33_q8); // per-sample users carry on without a gap.
+}
+
+void calibration_set_vref(int32_t vref33_q8) {
+  if (vref33_q8 <= 0) return; // keep the last good scale.
+  cal_vref33_q8 = vref33_q8;
+  for (uint8_t c = 0; c < CAL_CHANNELS; c++) {
+    cal_channels[c].scale_q16 = (cal_channels[c].coeff_q16 * 256) / vref33_q8;
+    calibration_fold_zero(cal_channels[c]);
+  }
+}
+
+void calibration_set_zero(uint8_t channel, int32_t zero_q8) {
+  cal_channels[channel].zero_q8 = zero_q8;
+  calibration_fold_zero(cal_channels[channel]);
+}
+
+int8_t calibration_add_point(uint8_t channel, int32_t counts_q8, int32_t reference_u) {
+  if (channel >= CAL_POINT_CHANNELS) return -1;
+  cal_point_t *p = cal_points[channel];
+  uint8_t &n = cal_point_count[channel];
+  int32_t correction = reference_u - (int32_t)calibration_linear(cal_channels[channel], counts_q8);
+
+  // points too close to take both are replaced by the new one.
+  uint8_t i = 0;
+  while (i < n) {
+    if (abs(p[i].counts_q8 - counts_q8) > CAL_POINT_MIN_Q8) {
+      i++;
+      continue;
+    }
+    for (uint8_t j = i; j + 1 < n; j++) p[j] = p[j + 1];
+    n--;
+  }
+  i = 0;
+  while (i < n && p[i].counts_q8 < counts_q8) i++;
+  if (n >= CAL_POINTS) return -1;
+  for (uint8_t j = n; j > i; j--) p[j] = p[j - 1];
+  p[i].counts_q8 = counts_q8;
+  p[i].correction_u = correction;
+  n++;
+  calibration_compile_points(channel);
+  return n;
+}
+
+void calibration_clear_points(uint8_t channel) {
+  if (channel < CAL_POINT_CHANNELS) cal_point_count[channel] = 0;
+}
+
+int32_t calibration_apply(uint8_t channel, int32_t counts_q8) {
+  const cal_channel_t &cal = cal_channels[channel];
+  int64_t value = calibration_linear(cal, counts_q8);
+  if (channel < CAL_POINT_CHANNELS && cal_point_count[channel]) value += calibration_correction(channel, counts_q8);
+  if (value > INT32_MAX) return INT32_MAX;
+  if (value < INT32_MIN) return INT32_MIN;
+  return (int32_t)value;
+}
+
+int32_t calibration_counts(uint8_t channel, int64_t micro_units, bool with_offset) {
+  const cal_channel_t &cal = cal_channels[channel];
+  if (cal.scale_q16 == 0) return 0;
+  if (with_offset) micro_units -= cal.offset_u;
+  int64_t counts = (micro_units * 65536) / cal.scale_q16;
+  if (counts > INT32_MAX) return INT32_MAX;
+  if (counts < INT32_MIN) return INT32_MIN;
+  return (int32_t)counts;
+}
@@ -0,0 +1,69 @@
+// emonDC fixed-point calibration, free to use and modify.
+
+#ifndef _EMONDC_CALIBRATION_H
+#define _EMONDC_CALIBRATION_H
+
+#include <Arduino.h>
+
+// calibrated channels, results are in micro-volts or micro-amps.
+#define CAL_CURRENT_A 0
+#define CAL_VOLTAGE_A 1
+#define CAL_CURRENT_B 2
+#define CAL_VOLTAGE_B 3
+#define CAL_REF       4 // plain volts at the ADC pin, for the reference channels.
+#define CAL_CHANNELS  5
+
+struct cal_channel_t {
+  int64_t coeff_q16; // micro-units per (count / VREF33 count), Q16, from the config.
+  int64_t scale_q16; // micro-units per count, Q16, follows the measured VREF33.
+  int32_t offset_u;  // offset in micro-units, added after scaling, includes the zero.
+  int32_t base_offset_u; // offset from the config alone.
+  int32_t zero_q8;   // learned zero in counts Q8, see autozero.h, taken off as part of offset_u.
+};
+
+extern cal_channel_t cal_channels[CAL_CHANNELS];
+
+// Correction points for the nonlinear ends of the amplifiers, channels 0-3.
+// Each point is the interval average in counts Q8 (as passed to
+// calibration_apply) and what the reference meter read less what the linear
+// calibration gave at the time. Between points the correction is
+// interpolated, beyond the end points it is held. The corrections are on top
+// of ical/vcal and the offsets, clear the points after changing those.
+#define CAL_POINT_CHANNELS 4
+#define CAL_POINTS         8
+// a new point closer than this to an old one, counts Q8, replaces it.
+#define CAL_POINT_MIN_Q8   (16 * 256)
+
+struct cal_point_t {
+  int32_t counts_q8;
+  int32_t correction_u;
+};
+
+extern cal_point_t cal_points[CAL_POINT_CHANNELS][CAL_POINTS]; // sorted by counts.
+extern uint8_t cal_point_count[CAL_POINT_CHANNELS];
+
+// Fold gains, shunts, dividers, ical/vcal and offsets into integer coefficients,
+// and the correction points into segments.
+// Call after the config is loaded or saved, this is the only double maths.
+void calibration_compile(void);
+
+// Add a point from an interval average and the reference reading, micro-units.
+// Returns the number of points, or -1 if the channel is full.
+int8_t calibration_add_point(uint8_t channel, int32_t counts_q8, int32_t reference_u);
+void calibration_clear_points(uint8_t channel);
+
+// Rescale every channel to the averaged VREF33 reading, counts in Q8 (1/256 LSB).
+void calibration_set_vref(int32_t vref33_q8);
+
+// Counts (Q8) that read as zero, folded into the offset at the current scale.
+void calibration_set_zero(uint8_t channel, int32_t zero_q8);
+
+// ADC counts in Q8 (reference already removed for current channels) to micro-units.
+int32_t calibration_apply(uint8_t channel, int32_t counts_q8);
+
+// Micro-units back to whole ADC counts at the current scale, leave the offset
+// out for a difference rather than a level. 0 if the channel has no scale.
+// The correction points are left out, close enough for trigger levels.
+int32_t calibration_counts(uint8_t channel, int64_t micro_units, bool with_offset);
+
+#endif // _EMONDC_CALIBRATION_H
@@ -0,0 +1,241 @@
+// emonDC triggered waveform capture, free to use and modify.
+
+// capture_sample is called from emondc_loop as it drains the sampler, next to
+// the averaging, and does no more than compare raw counts and copy one sample
+// set. The trigger levels are turned into counts by capture_compile after each
+// averaging interval, so there is no floating point per sample.
+// Once a trigger has been followed by CAPTURE_POST_SAMPLES more samples, the
+// ring stops and capture_loop writes the file a block at a time, holding the
+// SPI bus only for each block, so the sampling carries on in between. Triggers
+// are edge triggered and held off for CAPTURE_HOLDOFF_MS after each capture, a
+// sustained fault gives one capture rather than filling the card.
+
+#include "capture.h"
+#include "calibration.h"
+#include "sampler.h"
+#include "sdlog.h"
+#include "emondc.h"
+#include "debug.h"
+
+#include <SD.h>
+#include <RTClib.h>
+#include <time.h>
+
+double capture_current_max = 0;
+double capture_voltage_min = 0;
+double capture_dvdt = 0;
+unsigned long capture_count = 0;
+
+enum capture_state_t { CAPTURE_OFF, CAPTURE_ARMED, CAPTURE_POST, CAPTURE_WRITE, CAPTURE_HOLDOFF };
+
+static capture_state_t capture_state = CAPTURE_OFF;
+static uint16_t capture_pre[CAPTURE_PRE_SAMPLES][CAPTURE_CHANNELS];
+static uint16_t capture_post[CAPTURE_POST_SAMPLES][CAPTURE_CHANNELS];
+static uint16_t capture_head = 0;   // next ring slot.
+static uint16_t capture_filled = 0; // ring samples held, up to CAPTURE_PRE_SAMPLES.
+static uint16_t capture_posted = 0;
+static bool capture_was_hit = false;
+static unsigned long capture_triggerMillis = 0;
+static unsigned long capture_doneMillis = 0;
+
+// trigger levels in raw counts, see capture_compile.
+static int32_t capture_current_hi = 0;
+static int32_t capture_current_lo = 0;
+static int32_t capture_voltage_lo = 0;
+static int32_t capture_dvdt_counts = 0;
+
+static capture_header_t capture_header;
+static File capture_file;
+static uint32_t capture_written = 0;
+
+
+//-------------------------
+// Trigger
+//-------------------------
+void capture_compile(int32_t ref_A_q8, int32_t ref_B_q8) {
+  if (capture_current_max > 0) {
+    int32_t ref = ref_B_q8 >> 8;
+    int64_t limit = (int64_t)(capture_current_max * 1e6);
+    int32_t up = calibration_counts(CAL_CURRENT_B, limit, true);
+    int32_t down = calibration_counts(CAL_CURRENT_B, -limit, true);
+    capture_current_hi = ref + max(up, down); // either way round, the scale can be negative.
+    capture_current_lo = ref + min(up, down);
+  }
+  if (capture_voltage_min > 0) {
+    capture_voltage_lo = calibration_counts(CAL_VOLTAGE_B, (int64_t)(capture_voltage_min * 1e6), true);
+  }
+  if (capture_dvdt > 0 && sample_rate_hz > 0) {
+    // change over CAPTURE_DVDT_SPAN samples.
+    int64_t change = (int64_t)(capture_dvdt * 1e6 * CAPTURE_DVDT_SPAN / sample_rate_hz);
+    capture_dvdt_counts = abs(calibration_counts(CAL_VOLTAGE_B, change, false));
+    if (capture_dvdt_counts < 1) capture_dvdt_counts = 1;
+  }
+
+  capture_header.ref_A_q8 = ref_A_q8;
+  capture_header.ref_B_q8 = ref_B_q8;
+  if (capture_state == CAPTURE_OFF) capture_state = CAPTURE_ARMED;
+}
+
+static uint8_t capture_check(const uint16_t *readings) {
+  if (capture_current_max > 0) {
+    int32_t current = readings[2];
+    if (current > capture_current_hi || current < capture_current_lo) return CAPTURE_TRIGGER_CURRENT;
+  }
+  if (capture_voltage_min > 0 && (int32_t)readings[3] < capture_voltage_lo) return CAPTURE_TRIGGER_VOLTAGE;
+  if (capture_dvdt > 0 && capture_filled >= CAPTURE_DVDT_SPAN) {
+    uint16_t then = (capture_head + CAPTURE_PRE_SAMPLES - CAPTURE_DVDT_SPAN) % CAPTURE_PRE_SAMPLES;
+    if (abs((int32_t)readings[3] - (int32_t)capture_pre[then][3]) > capture_dvdt_counts) return CAPTURE_TRIGGER_DVDT;
+  }
+  return 0;
+}
+
+void capture_sample(const uint16_t *readings) {
+  switch (capture_state) {
+    case CAPTURE_ARMED:
+    case CAPTURE_HOLDOFF: {
+      uint8_t trigger = capture_check(readings);
+      bool edge = trigger && !capture_was_hit;
+      capture_was_hit = trigger != 0;
+      if (edge && capture_state == CAPTURE_ARMED) {
+        capture_header.trigger = trigger;
+        capture_triggerMillis = millis();
+        capture_posted = 0;
+        capture_state = CAPTURE_POST;
+        break; // the trigger sample is the first post-trigger one.
+      }
+      memcpy(capture_pre[capture_head], readings, sizeof(capture_pre[0]));
+      capture_head = (capture_head + 1) % CAPTURE_PRE_SAMPLES;
+      if (capture_filled < CAPTURE_PRE_SAMPLES) capture_filled++;
+      return;
+    }
+    case CAPTURE_POST:
+      break;
+    default:
+      return;
+  }
+
+  memcpy(capture_post[capture_posted], readings, sizeof(capture_post[0]));
+  if (++capture_posted >= CAPTURE_POST_SAMPLES) {
+    capture_written = 0;
+    capture_state = CAPTURE_WRITE;
+  }
+}
+
+bool capture_busy(void) {
+  return capture_state == CAPTURE_POST || capture_state == CAPTURE_WRITE;
+}
+
+
+//-------------------------
+// Writing
+//-------------------------
+// Next contiguous piece of the capture from byte offset, 0 at the end.
+static size_t capture_piece(uint32_t offset, const uint8_t *&data) {
+  const size_t sample = sizeof(capture_pre[0]);
+  if (offset < sizeof(capture_header)) {
+    data = (const uint8_t *)&capture_header + offset;
+    return sizeof(capture_header) - offset;
+  }
+  offset -= sizeof(capture_header);
+
+  uint32_t pre_bytes = (uint32_t)capture_filled * sample;
+  if (offset < pre_bytes) {
+    // oldest first, the ring wraps at most once.
+    uint16_t first = (capture_head + CAPTURE_PRE_SAMPLES - capture_filled) % CAPTURE_PRE_SAMPLES;
+    uint16_t index = (first + offset / sample) % CAPTURE_PRE_SAMPLES;
+    data = (const uint8_t *)capture_pre[index] + offset % sample;
+    size_t len = (CAPTURE_PRE_SAMPLES - index) * sample - offset % sample;
+    return min((size_t)(pre_bytes - offset), len);
+  }
+  offset -= pre_bytes;
+
+  uint32_t post_bytes = (uint32_t)capture_posted * sample;
+  if (offset < post_bytes) {
+    data = (const uint8_t *)capture_post[0] + offset;
+    return post_bytes - offset;
+  }
+  return 0;
+}
+
+static bool capture_open(void) {
+  uint32_t time;
+  bool rtc_time = timeConfidence;
+  unsigned long ago = (millis() - capture_triggerMillis) / 1000;
+  if (rtc_time) time = ::time(nullptr) - ago; // the system clock is set from the RTC and NTP.
+  else time = (capture_triggerMillis / 1000) - _t_begin;
+
+  char filename[40];
+  if (rtc_time) {
+    DateTime t(time);
+    sprintf(filename, CAPTURE_DIR "/%04d%02d%02d-%02d%02d%02d.bin",
+            t.year(), t.month(), t.day(), t.hour(), t.minute(), t.second());
+  } else {
+    sprintf(filename, CAPTURE_DIR "/run-%lu.bin", (unsigned long)time);
+  }
+
+  if (!SD.exists(CAPTURE_DIR)) SD.mkdir(CAPTURE_DIR);
+  SD.remove(filename);
+  capture_file = SD.open(filename, FILE_WRITE);
+  if (!capture_file) {
+    DBUGF("capture: can't open %s", filename);
+    return false;
+  }
+
+  memcpy(capture_header.magic, CAPTURE_MAGIC, sizeof(capture_header.magic));
+  capture_header.time = time;
+  capture_header.rtc_time = rtc_time;
+  capture_header.channels = CAPTURE_CHANNELS;
+  capture_header.reserved = 0;
+  capture_header.sample_rate_hz = sample_rate_hz;
+  capture_header.pre_samples = capture_filled;
+  capture_header.post_samples = capture_posted;
+  capture_header.reserved2 = 0;
+  for (uint8_t ch = 0; ch < CAPTURE_CHANNELS; ch++) {
+    capture_header.scale_q16[ch] = cal_channels[ch].scale_q16;
+    capture_header.offset_u[ch] = cal_channels[ch].offset_u;
+  }
+  Serial.print("capture: "); Serial.println(filename);
+  return true;
+}
+
+static void capture_done(void) {
+  capture_filled = 0; // the ring refills with fresh samples during the holdoff.
+  capture_head = 0;
+  capture_doneMillis = millis();
+  capture_state = CAPTURE_HOLDOFF;
+}
+
+void capture_loop(void) {
+  if (capture_state == CAPTURE_HOLDOFF) {
+    if (millis() - capture_doneMillis >= CAPTURE_HOLDOFF_MS) capture_state = CAPTURE_ARMED;
+    return;
+  }
+  if (capture_state != CAPTURE_WRITE) return;
+
+  SamplerBusLock busLock;
+  if (capture_written == 0 && !capture_open()) {
+    capture_done();
+    return;
+  }
+
+  // a block per pass, so the sampler's ring drains in between.
+  size_t budget = SDLOG_BLOCK_SIZE;
+  const uint8_t *data;
+  size_t len;
+  while (budget > 0 && (len = capture_piece(capture_written, data)) > 0) {
+    len = min(len, budget);
+    if (capture_file.write(data, len) != len) {
+      DBUGLN("capture: write failed");
+      capture_file.close();
+      capture_done();
+      return;
+    }
+    capture_written += len;
+    budget -= len;
+  }
+  if (capture_piece(capture_written, data) > 0) return;
+
+  capture_file.close();
+  capture_count++;
+  capture_done();
+}
@@ -0,0 +1,61 @@
+// emonDC triggered waveform capture, free to use and modify.
+
+#ifndef _EMONDC_CAPTURE_H
+#define _EMONDC_CAPTURE_H
+
+#include <Arduino.h>
+
+// Raw samples of ADC channels 0-3 (A current, A voltage, B current, B voltage)
+// are kept in a ring. When channel B crosses a trigger, the ring and the
+// samples that follow are written to captures/<date>-<time>.bin on the SD card.
+#ifndef CAPTURE_PRE_SAMPLES
+#define CAPTURE_PRE_SAMPLES  256
+#endif
+#ifndef CAPTURE_POST_SAMPLES
+#define CAPTURE_POST_SAMPLES 256
+#endif
+#define CAPTURE_CHANNELS     4
+#define CAPTURE_DVDT_SPAN    4        // samples the dV/dt is measured over, for less noise.
+#define CAPTURE_HOLDOFF_MS   10000UL  // least time from one capture to the next.
+#define CAPTURE_DIR          "/captures"
+#define CAPTURE_MAGIC        "EDCCAP1"
+
+// Trigger settings, 0 for off: channel B current magnitude above, in A,
+// channel B voltage below, in V, and channel B voltage change faster than, in V/s.
+extern double capture_current_max;
+extern double capture_voltage_min;
+extern double capture_dvdt;
+extern unsigned long capture_count;
+
+enum capture_trigger_t { CAPTURE_TRIGGER_CURRENT = 1, CAPTURE_TRIGGER_VOLTAGE = 2, CAPTURE_TRIGGER_DVDT = 3 };
+
+// Capture file header, followed by pre_samples + post_samples sets of
+// CAPTURE_CHANNELS uint16 raw counts, oldest first. The trigger sample is the
+// first post-trigger one. Current counts still include the reference, ref_q8.
+struct capture_header_t {
+  char magic[8];
+  uint32_t time;         // unix time when rtc_time, seconds since sampling began otherwise.
+  uint8_t rtc_time;
+  uint8_t trigger;       // capture_trigger_t
+  uint8_t channels;
+  uint8_t reserved;
+  uint16_t sample_rate_hz;
+  uint16_t pre_samples;
+  uint16_t post_samples;
+  uint16_t reserved2;
+  int32_t ref_A_q8;      // averaged current references, counts in Q8.
+  int32_t ref_B_q8;
+  int64_t scale_q16[CAPTURE_CHANNELS]; // micro-units per count, Q16, see calibration.h.
+  int32_t offset_u[CAPTURE_CHANNELS];
+};
+
+// Turn the trigger settings into raw counts, call once the calibration and
+// reference averages are updated. Triggers are armed from the first call.
+void capture_compile(int32_t ref_A_q8, int32_t ref_B_q8);
+// Add one raw sample set, call for every sample taken.
+void capture_sample(const uint16_t *readings);
+// Write a finished capture to the SD card, a block per call.
+void capture_loop(void);
+bool capture_busy(void);
+
+#endif // _EMONDC_CAPTURE_H
@@ -0,0 +1,166 @@
+// emonDC energy and state of charge checkpoints, free to use and modify.
+
+// Flash only wears on erase. A record goes into the next blank slot of the
+// ring, and a sector is only erased as the ring comes round to it, which
+// leaves the other sectors' records as they were, so a power cut during an
+// erase or a write loses at most the record being written. At boot every
+// slot is read and the valid record, by magic and CRC, with the highest
+// sequence number wins.
+// With 4 sectors of 32 slots and a record every 10 minutes each sector is
+// erased about 410 times a year, some 4100 in ten years against the 10000 or
+// more the flash is rated for. The EEPROM copy this replaces rewrote its
+// whole sector hourly.
+// The ring is the top CHECKPOINT_SECTORS of the file system area, which this
+// firmware does not mount; without room there it falls back to the EEPROM.
+
+#include "checkpoint.h"
+#include "emondc.h"
+#include "energy.h"
+#include "battery.h"
+#include "config.h"
+
+#include <flash_hal.h>
+
+#define CHECKPOINT_SLOTS_PER_SECTOR (SPI_FLASH_SEC_SIZE / CHECKPOINT_SLOT_SIZE)
+#define CHECKPOINT_SLOTS            (CHECKPOINT_SECTORS * CHECKPOINT_SLOTS_PER_SECTOR)
+
+struct checkpoint_record_t {
+  uint32_t magic;
+  uint32_t sequence;
+  double totals[8];
+  double state_of_charge;
+  float uncertainty;
+  uint32_t crc;            // of everything before it.
+};
+
+static_assert(sizeof(checkpoint_record_t) <= CHECKPOINT_SLOT_SIZE, "checkpoint record must fit a slot");
+static_assert(sizeof(checkpoint_record_t) % 4 == 0, "flash is written in words");
+
+uint32_t checkpoint_writes = 0;
+uint32_t checkpoint_sequence = 0;
+
+static uint32_t checkpoint_base = 0;  // flash offset of the ring, 0 when there is no room for it.
+static uint16_t checkpoint_next = 0;  // slot for the next record.
+
+static double *const checkpoint_totals[8] = {&Wh_chA_positive, &Wh_chA_negative, &Wh_chB_positive, &Wh_chB_negative,
+                                             &Ah_positive_A, &Ah_negative_A, &Ah_positive_B, &Ah_negative_B};
+
+
+uint32_t checkpoint_crc(const void *data, size_t len) {
+  const uint8_t *p = (const uint8_t *)data;
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= p[i];
+    for (uint8_t b = 0; b < 8; b++) crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+  }
+  return ~crc;
+}
+
+static uint32_t checkpoint_address(uint16_t slot) {
+  return checkpoint_base + (slot / CHECKPOINT_SLOTS_PER_SECTOR) * SPI_FLASH_SEC_SIZE
+         + (slot % CHECKPOINT_SLOTS_PER_SECTOR) * CHECKPOINT_SLOT_SIZE;
+}
+
+static bool checkpoint_read(uint16_t slot, checkpoint_record_t &r) {
+  ESP.flashRead(checkpoint_address(slot), (uint32_t *)&r, sizeof(r));
+  return r.magic == CHECKPOINT_MAGIC && r.crc == checkpoint_crc(&r, offsetof(checkpoint_record_t, crc));
+}
+
+static bool checkpoint_blank(uint16_t slot) {
+  uint32_t words[sizeof(checkpoint_record_t) / 4];
+  ESP.flashRead(checkpoint_address(slot), words, sizeof(words));
+  for (uint8_t i = 0; i < sizeof(words) / 4; i++) {
+    if (words[i] != 0xFFFFFFFF) return false;
+  }
+  return true;
+}
+
+// first slot of the sector after slot's, erased before it is written.
+static uint16_t checkpoint_next_sector(uint16_t slot) {
+  return ((slot / CHECKPOINT_SLOTS_PER_SECTOR + 1) % CHECKPOINT_SECTORS) * CHECKPOINT_SLOTS_PER_SECTOR;
+}
+
+
+//-------------------------
+// Boot
+//-------------------------
+bool checkpoint_setup(void) {
+  if (FS_PHYS_SIZE < CHECKPOINT_SECTORS * SPI_FLASH_SEC_SIZE) {
+    Serial.println("checkpoint: no room in flash, saving to EEPROM.");
+    return false;
+  }
+  checkpoint_base = FS_PHYS_ADDR + FS_PHYS_SIZE - CHECKPOINT_SECTORS * SPI_FLASH_SEC_SIZE;
+
+  checkpoint_record_t r, newest;
+  int16_t newest_slot = -1;
+  for (uint16_t slot = 0; slot < CHECKPOINT_SLOTS; slot++) {
+    if (!checkpoint_read(slot, r)) continue;
+    if (newest_slot < 0 || r.sequence > newest.sequence) {
+      newest = r;
+      newest_slot = slot;
+    }
+  }
+  if (newest_slot < 0) {
+    checkpoint_next = 0;
+    Serial.println("checkpoint: none, totals from EEPROM.");
+    return false;
+  }
+
+  for (uint8_t i = 0; i < 8; i++) *checkpoint_totals[i] = newest.totals[i];
+  state_of_charge = newest.state_of_charge;
+  battery_state.uncertainty = newest.uncertainty;
+  checkpoint_sequence = newest.sequence;
+
+  // carry on after it, unless that slot was half written when the power went.
+  checkpoint_next = (newest_slot + 1) % CHECKPOINT_SLOTS;
+  if (checkpoint_next % CHECKPOINT_SLOTS_PER_SECTOR != 0 && !checkpoint_blank(checkpoint_next)) {
+    checkpoint_next = checkpoint_next_sector(newest_slot);
+  }
+  Serial.print("checkpoint: restored sequence "); Serial.print(checkpoint_sequence);
+  Serial.print(" state_of_charge:"); Serial.println(state_of_charge);
+  return true;
+}
+
+
+//-------------------------
+// Save
+//-------------------------
+void checkpoint_save(void) {
+  if (checkpoint_base == 0) {
+    config_save_energy();
+    return;
+  }
+  checkpoint_record_t r;
+  memset(&r, 0xFF, sizeof(r));
+  r.magic = CHECKPOINT_MAGIC;
+  r.sequence = checkpoint_sequence + 1;
+  for (uint8_t i = 0; i < 8; i++) r.totals[i] = *checkpoint_totals[i];
+  r.state_of_charge = state_of_charge;
+  r.uncertainty = battery_state.uncertainty;
+  r.crc = checkpoint_crc(&r, offsetof(checkpoint_record_t, crc));
+
+  for (uint8_t attempt = 0; attempt < 2; attempt++) {
+    uint32_t address = checkpoint_address(checkpoint_next);
+    if (checkpoint_next % CHECKPOINT_SLOTS_PER_SECTOR == 0) ESP.flashEraseSector(address / SPI_FLASH_SEC_SIZE);
+    ESP.flashWrite(address, (uint32_t *)&r, sizeof(r));
+    checkpoint_record_t check;
+    bool written = checkpoint_read(checkpoint_next, check) && check.sequence == r.sequence;
+    uint16_t slot = checkpoint_next;
+    checkpoint_next = (checkpoint_next + 1) % CHECKPOINT_SLOTS;
+    if (written) {
+      checkpoint_sequence = r.sequence;
+      checkpoint_writes++;
+      return;
+    }
+    // the slot was not blank, start again on a freshly erased sector.
+    checkpoint_next = checkpoint_next_sector(slot);
+  }
+  Serial.println("checkpoint: write failed.");
+}
+
+void checkpoint_clear(void) {
+  if (checkpoint_base == 0) return;
+  for (uint8_t s = 0; s < CHECKPOINT_SECTORS; s++) ESP.flashEraseSector(checkpoint_base / SPI_FLASH_SEC_SIZE + s);
+  checkpoint_next = 0;
+  checkpoint_sequence = 0;
+}
@@ -0,0 +1,36 @@
+// emonDC energy and state of charge checkpoints, free to use and modify.
+
+#ifndef _EMONDC_CHECKPOINT_H
+#define _EMONDC_CHECKPOINT_H
+
+#include <Arduino.h>
+
+// The energy totals and the state of charge are written as small records to
+// a ring of flash sectors at the top of the (unused) file system area, each
+// record in the next blank slot, so a sector is only erased once per
+// CHECKPOINT_SECTORS x slots per sector writes.
+#define CHECKPOINT_SECTORS   4
+#define CHECKPOINT_SLOT_SIZE 128
+#define CHECKPOINT_MAGIC     0x31434445UL // "EDC1"
+
+// written this often while running, and on a controlled restart.
+#ifndef CHECKPOINT_INTERVAL_MS
+#define CHECKPOINT_INTERVAL_MS 600000UL
+#endif
+
+// records written since boot, and the sequence number of the newest.
+extern uint32_t checkpoint_writes;
+extern uint32_t checkpoint_sequence;
+
+// Restore the newest valid record over what the config loaded, false if none.
+// Call after the config is loaded and before the deep sleep state.
+bool checkpoint_setup(void);
+// Write a record of the totals now.
+void checkpoint_save(void);
+// Erase the ring, with the factory reset.
+void checkpoint_clear(void);
+
+// CRC-32 (IEEE), for the records here and the deep sleep state.
+uint32_t checkpoint_crc(const void *data, size_t len);
+
+#endif // _EMONDC_CHECKPOINT_H
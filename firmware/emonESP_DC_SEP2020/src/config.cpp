@@ -26,6 +26,17 @@
 #include "emonesp.h"
 #include "config.h"
 #include "emondc.h"
+#include "sampler.h"
+#include "calibration.h"
+#include "capture.h"
+#include "oversample.h"
+#include "filter.h"
+#include "autozero.h"
+#include "sleep.h"
+#include "energy.h"
+#include "battery.h"
+#include "checkpoint.h"
+#include "mqtt.h"
 
 #include <Arduino.h>
 #include <EEPROM.h>                   // Save config settings
@@ -53,6 +64,7 @@ String mqtt_topic = "";
 String mqtt_user = "";
 String mqtt_pass = "";
 String mqtt_feed_prefix = "";
+bool mqtt_json_mode = false;
 
 
 #define EEPROM_ESID_SIZE          32
@@ -176,8 +188,48 @@ String mqtt_feed_prefix = "";
 
 #define EEPROM_SIG_START          (EEPROM_BATTTEMPCO_START + EEPROM_DOUBLE_SIZE)
 #define EEPROM_SIG_END            (EEPROM_SIG_START + EEPROM_SIG_SIZE)
+/* EMONDC SETTINGS ADDED AFTER THE SIGNATURE, 0 or 0xFF.. reads as unset: */
+#define EEPROM_SAMPLE_RATE_START          EEPROM_SIG_END
+#define EEPROM_SAMPLE_RATE_END            (EEPROM_SAMPLE_RATE_START + EEPROM_INT_SIZE)
+#define EEPROM_ENERGY_START               EEPROM_SAMPLE_RATE_END // Wh then Ah totals, A+ A- B+ B-, checkpoint.h is newer.
+#define EEPROM_ENERGY_END                 (EEPROM_ENERGY_START + 8 * EEPROM_DOUBLE_SIZE)
+#define EEPROM_MQTT_JSON_START            EEPROM_ENERGY_END // 1 for JSON, anything else per field.
+#define EEPROM_MQTT_JSON_END              (EEPROM_MQTT_JSON_START + 1)
+#define EEPROM_CAPTURE_START              EEPROM_MQTT_JSON_END // current, voltage, dV/dt triggers.
+#define EEPROM_CAPTURE_END                (EEPROM_CAPTURE_START + 3 * EEPROM_DOUBLE_SIZE)
+#define EEPROM_OVERSAMPLE_START           EEPROM_CAPTURE_END // bits A, bits B, filter, 0xFF unset.
+#define EEPROM_OVERSAMPLE_END             (EEPROM_OVERSAMPLE_START + 3)
+#define EEPROM_SCHEDULE_START             EEPROM_OVERSAMPLE_END // per channel, log2(divider) + 1, 9 once per interval.
+#define EEPROM_SCHEDULE_END               (EEPROM_SCHEDULE_START + SAMPLER_CHANNELS)
+#define EEPROM_SCHEDULE_ONCE              9
+#define EEPROM_FILTER_START               EEPROM_SCHEDULE_END // flags per channel, 0xFF unset.
+#define EEPROM_FILTER_IIR_START           (EEPROM_FILTER_START + FILTER_CHANNELS)
+#define EEPROM_FILTER_NOTCH_START         (EEPROM_FILTER_IIR_START + 1)
+#define EEPROM_FILTER_END                 (EEPROM_FILTER_NOTCH_START + EEPROM_INT_SIZE)
+#define EEPROM_AUTOZERO_START             EEPROM_FILTER_END // 1 for idle learning.
+#define EEPROM_AUTOZERO_IDLE_START        (EEPROM_AUTOZERO_START + 1)
+#define EEPROM_AUTOZERO_ZERO_START        (EEPROM_AUTOZERO_IDLE_START + EEPROM_DOUBLE_SIZE) // int32 zero, weight.
+#define EEPROM_AUTOZERO_BIN_START         (EEPROM_AUTOZERO_ZERO_START + AUTOZERO_CHANNELS * 5)
+#define EEPROM_AUTOZERO_END               (EEPROM_AUTOZERO_BIN_START + 2 * AUTOZERO_BINS * 5)
+#define EEPROM_CALPOINTS_START            EEPROM_AUTOZERO_END // per channel, count then int32 counts, correction.
+#define EEPROM_CALPOINTS_CHANNEL_SIZE     (1 + CAL_POINTS * 8)
+#define EEPROM_CALPOINTS_END              (EEPROM_CALPOINTS_START + CAL_POINT_CHANNELS * EEPROM_CALPOINTS_CHANNEL_SIZE)
+#define EEPROM_SLEEP_START                EEPROM_CALPOINTS_END // 1 for low power mode.
+#define EEPROM_SLEEP_WAKING_START         (EEPROM_SLEEP_START + 1) // ms, uint32.
+#define EEPROM_SLEEP_SLEEPING_START       (EEPROM_SLEEP_WAKING_START + 4)
+#define EEPROM_SLEEP_POST_EVERY_START     (EEPROM_SLEEP_SLEEPING_START + 4)
+#define EEPROM_SLEEP_END                  (EEPROM_SLEEP_POST_EVERY_START + 1)
+#define EEPROM_SOC_START                  EEPROM_SLEEP_END // state of charge, uncertainty, as the energy totals.
+#define EEPROM_SOC_END                    (EEPROM_SOC_START + 2 * EEPROM_DOUBLE_SIZE)
 
 
+// -------------------------------------------------------------------
+// Commit to flash, the sampling ISR is in IRAM and carries on meanwhile.
+// -------------------------------------------------------------------
+void EEPROM_commit(){
+  EEPROM.commit();
+}
+
 // -------------------------------------------------------------------
 // Reset EEPROM, wipes all settings
 // -------------------------------------------------------------------
@@ -187,7 +239,7 @@ void ResetEEPROM(){
     EEPROM.write(i, 0);
     //DEBUG.print("#");
   }
-  EEPROM.commit();
+  EEPROM_commit();
 }
 
 void EEPROM_read_string(int start, int count, String & val) {
@@ -309,6 +361,8 @@ void config_load_settings()
   EEPROM_read_string(EEPROM_MQTT_FEED_PREFIX_START, EEPROM_MQTT_FEED_PREFIX_SIZE, mqtt_feed_prefix);
   EEPROM_read_string(EEPROM_MQTT_USER_START, EEPROM_MQTT_USER_SIZE, mqtt_user);
   EEPROM_read_string(EEPROM_MQTT_PASS_START, EEPROM_MQTT_PASS_SIZE, mqtt_pass);
+  mqtt_json_mode = (EEPROM.read(EEPROM_MQTT_JSON_START) == 1);
+  mqtt_topics_update();
 
   //----------------------
   // emonDC settings
@@ -378,6 +432,117 @@ void config_load_settings()
   Serial.print("BattPeukert:"); Serial.println(BattPeukert);
   EEPROM_read_double(EEPROM_BATTTEMPCO_START, BattTempCo);
   Serial.print("BattTempCo:"); Serial.println(BattTempCo);
+  battery_configure();
+
+  uint16_t _sample_rate;
+  EEPROM_read_int(EEPROM_SAMPLE_RATE_START, _sample_rate);
+  if (_sample_rate != 0 && _sample_rate != 0xFFFF) sample_rate_hz = _sample_rate;
+  Serial.print("sample_rate_hz:"); Serial.println(sample_rate_hz);
+
+  uint8_t *oversample_settings[3] = {&oversample_bits_A, &oversample_bits_B, &oversample_filter};
+  for (int i = 0; i < 3; i++) {
+    uint8_t _setting = EEPROM.read(EEPROM_OVERSAMPLE_START + i);
+    if (_setting != 0xFF) *oversample_settings[i] = _setting;
+  }
+  oversample_configure();
+
+  uint8_t _schedule[SAMPLER_CHANNELS];
+  memcpy(_schedule, sampler_divider, sizeof(_schedule));
+  for (int ch = 0; ch < SAMPLER_CHANNELS; ch++) {
+    uint8_t code = EEPROM.read(EEPROM_SCHEDULE_START + ch);
+    if (code == EEPROM_SCHEDULE_ONCE) _schedule[ch] = SAMPLER_ONCE;
+    else if (code >= 1 && code <= 8) _schedule[ch] = 1 << (code - 1);
+  }
+  sampler_set_schedule(_schedule);
+  Serial.print("sample schedule:"); Serial.println(config_schedule_string());
+
+  for (int ch = 0; ch < FILTER_CHANNELS; ch++) {
+    uint8_t _flags = EEPROM.read(EEPROM_FILTER_START + ch);
+    filter_flags[ch] = (_flags == 0xFF) ? 0 : _flags;
+  }
+  uint8_t _shift = EEPROM.read(EEPROM_FILTER_IIR_START);
+  if (_shift != 0 && _shift != 0xFF) filter_iir_shift = _shift;
+  uint16_t _notch;
+  EEPROM_read_int(EEPROM_FILTER_NOTCH_START, _notch);
+  filter_notch_hz = (_notch == 0xFFFF) ? 0 : _notch;
+  filter_configure();
+  Serial.print("filters:"); Serial.print(config_filters_string()); Serial.print(" iir shift:");
+  Serial.print(filter_iir_shift); Serial.print(" notch Hz:"); Serial.println(filter_notch_hz);
+
+  autozero_enabled = (EEPROM.read(EEPROM_AUTOZERO_START) == 1);
+  double _idle_amps;
+  EEPROM_read_double(EEPROM_AUTOZERO_IDLE_START, _idle_amps);
+  if (!isnan(_idle_amps) && _idle_amps > 0.0) autozero_idle_amps = _idle_amps;
+  for (int i = 0; i < AUTOZERO_CHANNELS + 2 * AUTOZERO_BINS; i++) {
+    int start = EEPROM_AUTOZERO_ZERO_START + i * 5;
+    int32_t *zero = (i < AUTOZERO_CHANNELS) ? &autozero_zero_q8[i] : &autozero_bin_q8[0][0] + (i - AUTOZERO_CHANNELS);
+    uint8_t *weight = (i < AUTOZERO_CHANNELS) ? &autozero_weight[i] : &autozero_bin_weight[0][0] + (i - AUTOZERO_CHANNELS);
+    uint32_t _zero;
+    EEPROM_read_long(start, _zero);
+    *zero = (int32_t)_zero;
+    *weight = EEPROM.read(start + 4);
+    if (*weight > AUTOZERO_WEIGHT_MAX) *weight = 0; // erased flash.
+  }
+  autozero_apply();
+
+  for (int ch = 0; ch < CAL_POINT_CHANNELS; ch++) {
+    int start = EEPROM_CALPOINTS_START + ch * EEPROM_CALPOINTS_CHANNEL_SIZE;
+    uint8_t n = EEPROM.read(start);
+    if (n > CAL_POINTS) n = 0;
+    for (int i = 0; i < n; i++) {
+      uint32_t _counts, _correction;
+      EEPROM_read_long(start + 1 + i * 8, _counts);
+      EEPROM_read_long(start + 5 + i * 8, _correction);
+      cal_points[ch][i].counts_q8 = (int32_t)_counts;
+      cal_points[ch][i].correction_u = (int32_t)_correction;
+      if (i > 0 && cal_points[ch][i].counts_q8 <= cal_points[ch][i - 1].counts_q8) n = 0; // not from config_save_calpoints.
+    }
+    cal_point_count[ch] = n;
+  }
+  Serial.print("calibration points:");
+  for (int ch = 0; ch < CAL_POINT_CHANNELS; ch++) { Serial.print(" "); Serial.print(cal_point_count[ch]); }
+  Serial.println();
+  low_power_mode = (EEPROM.read(EEPROM_SLEEP_START) == 1);
+  uint32_t _waking, _sleeping;
+  EEPROM_read_long(EEPROM_SLEEP_WAKING_START, _waking);
+  EEPROM_read_long(EEPROM_SLEEP_SLEEPING_START, _sleeping);
+  if (_waking != 0 && _waking != 0xFFFFFFFF) waking_time = _waking;
+  if (_sleeping != 0 && _sleeping != 0xFFFFFFFF) sleeping_time = _sleeping;
+  uint8_t _post_every = EEPROM.read(EEPROM_SLEEP_POST_EVERY_START);
+  if (_post_every != 0 && _post_every != 0xFF) sleep_post_every = _post_every;
+  Serial.print("low power:"); Serial.print(low_power_mode); Serial.print(" waking ms:"); Serial.print(waking_time);
+  Serial.print(" sleeping ms:"); Serial.print(sleeping_time); Serial.print(" post every:"); Serial.println(sleep_post_every);
+  Serial.print("autozero:"); Serial.print(autozero_enabled); Serial.print(" idle A:"); Serial.println(autozero_idle_amps);
+  Serial.print("oversample bits A,B filter:"); Serial.print(oversample_bits_A); Serial.print(",");
+  Serial.print(oversample_bits_B); Serial.print(" "); Serial.println(oversample_filter);
+
+  double *energy_totals[8] = {&Wh_chA_positive, &Wh_chA_negative, &Wh_chB_positive, &Wh_chB_negative,
+                              &Ah_positive_A, &Ah_negative_A, &Ah_positive_B, &Ah_negative_B};
+  for (int i = 0; i < 8; i++) {
+    double _total;
+    EEPROM_read_double(EEPROM_ENERGY_START + i * EEPROM_DOUBLE_SIZE, _total);
+    if (!isnan(_total) && _total > 0.0) *energy_totals[i] = _total; // erased flash reads as NaN.
+  }
+  Serial.print("Wh_chA_positive:"); Serial.println(Wh_chA_positive);
+  Serial.print("Wh_chB_positive:"); Serial.println(Wh_chB_positive);
+  double _soc, _uncertainty;
+  EEPROM_read_double(EEPROM_SOC_START, _soc);
+  EEPROM_read_double(EEPROM_SOC_START + EEPROM_DOUBLE_SIZE, _uncertainty);
+  // NaN when erased fails the range checks, all zeros is a wiped EEPROM.
+  if (_soc >= 0.0 && _soc <= 1.0 && _uncertainty >= 0.0 && _uncertainty <= 1.0 && (_soc > 0.0 || _uncertainty > 0.0)) {
+    state_of_charge = _soc;
+    battery_state.uncertainty = _uncertainty;
+  }
+  Serial.print("state_of_charge:"); Serial.print(state_of_charge); Serial.print(" confidence:"); Serial.println(battery_confidence(battery_state));
+
+  double *capture_triggers[3] = {&capture_current_max, &capture_voltage_min, &capture_dvdt};
+  for (int i = 0; i < 3; i++) {
+    double _trigger;
+    EEPROM_read_double(EEPROM_CAPTURE_START + i * EEPROM_DOUBLE_SIZE, _trigger);
+    if (!isnan(_trigger) && _trigger > 0.0) *capture_triggers[i] = _trigger;
+  }
+  Serial.print("capture triggers:"); Serial.print(capture_current_max); Serial.print(",");
+  Serial.print(capture_voltage_min); Serial.print(","); Serial.println(capture_dvdt);
 
   Serial.println(" "); 
 }
@@ -405,16 +570,18 @@ void config_save_emoncms(String server, String path, String node, String apikey,
   // save emoncms HTTPS fingerprint to EEPROM max 60 characters
   EEPROM_write_string(EEPROM_EMON_FINGERPRINT_START, EEPROM_EMON_FINGERPRINT_SIZE, emoncms_fingerprint);
 
-  EEPROM.commit();
+  EEPROM_commit();
 }
 
-void config_save_mqtt(String server, String topic, String prefix, String user, String pass)
+void config_save_mqtt(String server, String topic, String prefix, String user, String pass, bool json)
 {
   mqtt_server = server;
   mqtt_topic = topic;
   mqtt_feed_prefix = prefix;
   mqtt_user = user;
   mqtt_pass = pass;
+  mqtt_json_mode = json;
+  mqtt_topics_update();
 
   // Save MQTT server max 45 characters
   EEPROM_write_string(EEPROM_MQTT_SERVER_START, EEPROM_MQTT_SERVER_SIZE, mqtt_server);
@@ -431,7 +598,10 @@ void config_save_mqtt(String server, String topic, String prefix, String user, S
   // Save MQTT pass max 64 characters
   EEPROM_write_string(EEPROM_MQTT_PASS_START, EEPROM_MQTT_PASS_SIZE, mqtt_pass);
 
-  EEPROM.commit();
+  // Save MQTT publish mode
+  EEPROM.write(EEPROM_MQTT_JSON_START, mqtt_json_mode ? 1 : 0);
+
+  EEPROM_commit();
 }
 
 void config_save_admin(String user, String pass)
@@ -442,7 +612,7 @@ void config_save_admin(String user, String pass)
   EEPROM_write_string(EEPROM_WWW_USER_START, EEPROM_WWW_USER_SIZE, user);
   EEPROM_write_string(EEPROM_WWW_PASS_START, EEPROM_WWW_PASS_SIZE, pass);
 
-  EEPROM.commit();
+  EEPROM_commit();
 }
 
 void config_save_wifi(String qsid, String qpass)
@@ -453,7 +623,7 @@ void config_save_wifi(String qsid, String qpass)
   EEPROM_write_string(EEPROM_ESID_START, EEPROM_ESID_SIZE, qsid);
   EEPROM_write_string(EEPROM_EPASS_START, EEPROM_EPASS_SIZE, qpass);
 
-  EEPROM.commit();
+  EEPROM_commit();
 }
 
 void config_save_emondc(String qinterval, String qicalA, String qvcalA, String qicalB, String qvcalB,
@@ -462,7 +632,11 @@ String qR1_A, String qR2_A, String qR1_B, String qR2_B,
 String qRshunt_A, String qRshunt_B,
 String qAmpOffset_A, String qAmpOffset_B, String qVoltOffset_A, String qVoltOffset_B,
 String qBattType,String qBattCapacity,String qBattCapHr,String qBattNom,
-String qBattVoltsAlarmHigh,String qBattVoltsAlarmLow,String qBattPeukert,String qBattTempCo)
+String qBattVoltsAlarmHigh,String qBattVoltsAlarmLow,String qBattPeukert,String qBattTempCo,
+String qsample_rate, String qoversample_A, String qoversample_B, String qoversample_filter,
+String qschedule, String qfilters, String qfilter_iir_shift, String qfilter_notch_hz,
+String qautozero, String qautozero_idle_amps,
+String qlow_power, String qwaking_time, String qsleeping_time, String qsleep_post_every)
 {
   char char_array[15]; // temp storage of chars
   strcpy(char_array, qinterval.c_str());
@@ -521,8 +695,52 @@ String qBattVoltsAlarmHigh,String qBattVoltsAlarmLow,String qBattPeukert,String
   BattPeukert = atof(char_array);
   strcpy(char_array, qBattTempCo.c_str());
   BattTempCo = atof(char_array);
+  battery_configure(); // the Peukert capacity is kept worked out.
+
+  if (qsample_rate.length() > 0) { // left unchanged if not sent.
+    strcpy(char_array, qsample_rate.c_str());
+    int _sample_rate = atoi(char_array);
+    if (_sample_rate >= SAMPLER_RATE_MIN && _sample_rate <= SAMPLER_RATE_MAX) sampler_set_rate(_sample_rate);
+  }
+  if (qoversample_A.length() > 0) oversample_bits_A = qoversample_A.toInt();
+  if (qoversample_B.length() > 0) oversample_bits_B = qoversample_B.toInt();
+  if (qoversample_filter.length() > 0) oversample_filter = qoversample_filter.toInt();
+  oversample_configure(); // clamps the settings, restarts the filters.
+  if (qschedule.length() > 0) { // 8 comma separated dividers, left unchanged if not all there.
+    uint8_t _schedule[SAMPLER_CHANNELS];
+    int ch = 0;
+    int from = 0;
+    while (ch < SAMPLER_CHANNELS && from <= (int)qschedule.length()) {
+      int comma = qschedule.indexOf(',', from);
+      if (comma < 0) comma = qschedule.length();
+      _schedule[ch++] = constrain(qschedule.substring(from, comma).toInt(), 0, SAMPLER_SCHEDULE_PASSES);
+      from = comma + 1;
+    }
+    if (ch == SAMPLER_CHANNELS) sampler_set_schedule(_schedule);
+  }
+  if (qfilters.length() > 0) { // 4 comma separated flag sets, see filter.h.
+    int from = 0;
+    for (int ch = 0; ch < FILTER_CHANNELS && from <= (int)qfilters.length(); ch++) {
+      int comma = qfilters.indexOf(',', from);
+      if (comma < 0) comma = qfilters.length();
+      filter_flags[ch] = qfilters.substring(from, comma).toInt() & (FILTER_MEDIAN | FILTER_IIR | FILTER_NOTCH);
+      from = comma + 1;
+    }
+  }
+  if (qfilter_iir_shift.length() > 0) filter_iir_shift = qfilter_iir_shift.toInt();
+  if (qfilter_notch_hz.length() > 0) filter_notch_hz = qfilter_notch_hz.toInt();
+  filter_configure(); // after the sample rate, the notch depends on it.
+  if (qautozero.length() > 0) autozero_enabled = qautozero.toInt() == 1;
+  if (qautozero_idle_amps.length() > 0 && qautozero_idle_amps.toFloat() > 0) autozero_idle_amps = qautozero_idle_amps.toFloat();
+  if (qlow_power.length() > 0) low_power_mode = qlow_power.toInt() == 1;
+  // a wake has to hold at least one reading, deep sleep tops out at a little over 3 hours.
+  if (qwaking_time.length() > 0) waking_time = constrain(qwaking_time.toInt(), 1000, 600000);
+  if (qsleeping_time.length() > 0) sleeping_time = constrain(qsleeping_time.toInt(), 1000, 10800000);
+  if (qsleep_post_every.length() > 0) sleep_post_every = constrain(qsleep_post_every.toInt(), 1, SLEEP_BATCH_MAX);
 
 
+  calibration_compile(); // new integer scale factors.
+
   // save web_server entered values to flash:
   EEPROM_write_int(EEPROM_INTERVAL_START, EEPROM_INTERVAL_SIZE, main_interval_seconds);
   EEPROM_write_double(EEPROM_ICALA_START, EEPROM_ICALA_SIZE, icalA);
@@ -552,17 +770,110 @@ String qBattVoltsAlarmHigh,String qBattVoltsAlarmLow,String qBattPeukert,String
   EEPROM_write_double(EEPROM_BATTVARARMLOW_START, 8, BattVoltsAlarmLow);
   EEPROM_write_double(EEPROM_BATTPEUKERT_START, 8, BattPeukert);
   EEPROM_write_double(EEPROM_BATTTEMPCO_START, 8, BattTempCo);
+  EEPROM_write_int(EEPROM_SAMPLE_RATE_START, EEPROM_INT_SIZE, sample_rate_hz);
+  EEPROM.write(EEPROM_OVERSAMPLE_START, oversample_bits_A);
+  EEPROM.write(EEPROM_OVERSAMPLE_START + 1, oversample_bits_B);
+  EEPROM.write(EEPROM_OVERSAMPLE_START + 2, oversample_filter);
+  for (int ch = 0; ch < SAMPLER_CHANNELS; ch++) {
+    uint8_t divider = sampler_divider[ch];
+    uint8_t code = 1;
+    while ((1 << (code - 1)) < divider) code++;
+    EEPROM.write(EEPROM_SCHEDULE_START + ch, divider == SAMPLER_ONCE ? EEPROM_SCHEDULE_ONCE : code);
+  }
+  for (int ch = 0; ch < FILTER_CHANNELS; ch++) EEPROM.write(EEPROM_FILTER_START + ch, filter_flags[ch]);
+  EEPROM.write(EEPROM_FILTER_IIR_START, filter_iir_shift);
+  EEPROM_write_int(EEPROM_FILTER_NOTCH_START, EEPROM_INT_SIZE, filter_notch_hz);
+  EEPROM.write(EEPROM_AUTOZERO_START, autozero_enabled ? 1 : 0);
+  EEPROM_write_double(EEPROM_AUTOZERO_IDLE_START, EEPROM_DOUBLE_SIZE, autozero_idle_amps);
+  EEPROM.write(EEPROM_SLEEP_START, low_power_mode ? 1 : 0);
+  EEPROM_write_long(EEPROM_SLEEP_WAKING_START, 4, waking_time);
+  EEPROM_write_long(EEPROM_SLEEP_SLEEPING_START, 4, sleeping_time);
+  EEPROM.write(EEPROM_SLEEP_POST_EVERY_START, sleep_post_every);
 
   // using signature for init.
   EEPROM_write_string(EEPROM_SIG_START, EEPROM_SIG_SIZE, F("OEM"));
 
   Serial.println("emondc_save_config() done.");
 
-  EEPROM.commit();
+  EEPROM_commit();
+}
+
+// -------------------------------------------------------------------
+// Save the energy and charge totals, see energy.cpp for how often.
+// -------------------------------------------------------------------
+// Only where there is no room for the checkpoint ring, see checkpoint.cpp.
+void config_save_energy()
+{
+  double energy_totals[8] = {Wh_chA_positive, Wh_chA_negative, Wh_chB_positive, Wh_chB_negative,
+                             Ah_positive_A, Ah_negative_A, Ah_positive_B, Ah_negative_B};
+  for (int i = 0; i < 8; i++) {
+    EEPROM_write_double(EEPROM_ENERGY_START + i * EEPROM_DOUBLE_SIZE, EEPROM_DOUBLE_SIZE, energy_totals[i]);
+  }
+  EEPROM_write_double(EEPROM_SOC_START, EEPROM_DOUBLE_SIZE, state_of_charge);
+  EEPROM_write_double(EEPROM_SOC_START + EEPROM_DOUBLE_SIZE, EEPROM_DOUBLE_SIZE, battery_state.uncertainty);
+  EEPROM_commit();
+}
+
+String config_schedule_string()
+{
+  String s;
+  for (int ch = 0; ch < SAMPLER_CHANNELS; ch++) {
+    if (ch > 0) s += ",";
+    s += String(sampler_divider[ch]);
+  }
+  return s;
+}
+
+String config_filters_string()
+{
+  String s;
+  for (int ch = 0; ch < FILTER_CHANNELS; ch++) {
+    if (ch > 0) s += ",";
+    s += String(filter_flags[ch]);
+  }
+  return s;
+}
+
+void config_save_autozero()
+{
+  for (int i = 0; i < AUTOZERO_CHANNELS + 2 * AUTOZERO_BINS; i++) {
+    int start = EEPROM_AUTOZERO_ZERO_START + i * 5;
+    int32_t zero = (i < AUTOZERO_CHANNELS) ? autozero_zero_q8[i] : (&autozero_bin_q8[0][0])[i - AUTOZERO_CHANNELS];
+    uint8_t weight = (i < AUTOZERO_CHANNELS) ? autozero_weight[i] : (&autozero_bin_weight[0][0])[i - AUTOZERO_CHANNELS];
+    EEPROM_write_long(start, 4, zero);
+    EEPROM.write(start + 4, weight);
+  }
+  EEPROM_commit();
+}
+
+void config_save_calpoints()
+{
+  for (int ch = 0; ch < CAL_POINT_CHANNELS; ch++) {
+    int start = EEPROM_CALPOINTS_START + ch * EEPROM_CALPOINTS_CHANNEL_SIZE;
+    EEPROM.write(start, cal_point_count[ch]);
+    for (int i = 0; i < cal_point_count[ch]; i++) {
+      EEPROM_write_long(start + 1 + i * 8, 4, cal_points[ch][i].counts_q8);
+      EEPROM_write_long(start + 5 + i * 8, 4, cal_points[ch][i].correction_u);
+    }
+  }
+  EEPROM_commit();
+}
+
+void config_save_capture(double current, double voltage, double dvdt)
+{
+  capture_current_max = current > 0 ? current : 0;
+  capture_voltage_min = voltage > 0 ? voltage : 0;
+  capture_dvdt = dvdt > 0 ? dvdt : 0;
+  EEPROM_write_double(EEPROM_CAPTURE_START, EEPROM_DOUBLE_SIZE, capture_current_max);
+  EEPROM_write_double(EEPROM_CAPTURE_START + EEPROM_DOUBLE_SIZE, EEPROM_DOUBLE_SIZE, capture_voltage_min);
+  EEPROM_write_double(EEPROM_CAPTURE_START + 2 * EEPROM_DOUBLE_SIZE, EEPROM_DOUBLE_SIZE, capture_dvdt);
+  EEPROM_commit();
 }
 
 void config_reset()
 {
+  energy_reset(); // so a later save does not put them back.
+  checkpoint_clear();
   ResetEEPROM();
 }
 
@@ -58,6 +58,7 @@ extern String mqtt_topic;
 extern String mqtt_user;
 extern String mqtt_pass;
 extern String mqtt_feed_prefix;
+extern bool mqtt_json_mode; // one JSON message per interval instead of a topic per field.
 
 // -------------------------------------------------------------------
 // Load saved settings
@@ -72,7 +73,7 @@ extern void config_save_emoncms(String server, String path, String node, String
 // -------------------------------------------------------------------
 // Save the MQTT broker details
 // -------------------------------------------------------------------
-extern void config_save_mqtt(String server, String topic, String prefix, String user, String pass);
+extern void config_save_mqtt(String server, String topic, String prefix, String user, String pass, bool json);
 
 // -------------------------------------------------------------------
 // Save the admin/web interface details
@@ -93,7 +94,41 @@ String qR1_A, String qR2_A, String qR1_B, String qR2_B,
 String qRshunt_A, String qRshunt_B,
 String qAmpOffset_A, String qAmpOffset_B, String qVoltOffset_A, String qVoltOffset_B,
 String qBattType,String qBattCapacity,String qBattCapHr,String qBattNom,
-String qBattVoltsAlarmHigh,String qBattVoltsAlarmLow,String qBattPeukert,String qBattTempCo);
+String qBattVoltsAlarmHigh,String qBattVoltsAlarmLow,String qBattPeukert,String qBattTempCo,
+String qsample_rate, String qoversample_A, String qoversample_B, String qoversample_filter,
+String qschedule, String qfilters, String qfilter_iir_shift, String qfilter_notch_hz,
+String qautozero, String qautozero_idle_amps,
+String qlow_power, String qwaking_time, String qsleeping_time, String qsleep_post_every);
+
+// -------------------------------------------------------------------
+// Sample schedule as passes per reading, comma separated, 0 once per interval
+// -------------------------------------------------------------------
+extern String config_schedule_string();
+
+// -------------------------------------------------------------------
+// Filter flags per channel, comma separated, see filter.h
+// -------------------------------------------------------------------
+extern String config_filters_string();
+
+// -------------------------------------------------------------------
+// Save the energy and charge totals
+// -------------------------------------------------------------------
+extern void config_save_energy();
+
+// -------------------------------------------------------------------
+// Save the learned zero offsets
+// -------------------------------------------------------------------
+extern void config_save_autozero();
+
+// -------------------------------------------------------------------
+// Save the calibration correction points, see calibration.h
+// -------------------------------------------------------------------
+extern void config_save_calpoints();
+
+// -------------------------------------------------------------------
+// Save the waveform capture triggers, 0 turns one off
+// -------------------------------------------------------------------
+extern void config_save_capture(double current, double voltage, double dvdt);
 
 // -------------------------------------------------------------------
 // Reset the config back to defaults
@@ -62,8 +62,53 @@ function StatusViewModel() {
     "packets_sent": "",
     "packets_success": "",
     "emoncms_connected": "",
+    "emoncms_queued": "",
+    "emoncms_dropped": "",
+    "replay_from": "",
+    "replay_until": "0",
+    "replay_rows_sent": "",
+    "replay_held": "0",
     "mqtt_connected": "",
     "free_heap": "",
+    "heap_min": "",
+    "samples_hz": "",
+    "sample_cycles": "",
+    "cpu_mhz": 80,
+    "interval_us": "",
+    "interval_us_max": "",
+    "sample_rate": "",
+    "sampler_overruns": "",
+    "boot_sample_ms": "",
+    "boot_wifi_ms": "",
+    "boot_post_ms": "",
+    "sleep_avg_ma": "",
+    "sleep_wakes": "",
+    "sampler_underruns": "",
+    "sd_flush_us": "",
+    "sd_flush_us_max": "",
+    "sd_buffered_rows": "",
+    "ws_clients": "",
+    "streaming": "",
+    "capture_count": "",
+    "filter_cycles": "",
+    "filter_cycles_max": "",
+    "soc": "",
+    "soc_confidence": "",
+    "soc_profile": "",
+    "soc_fulls": "",
+    "soc_ocv_corrections": "",
+    "checkpoint_seq": "",
+    "zero_IA": "",
+    "zero_IB": "",
+    "zeroing": false,
+    "noise_IA": "",
+    "noise_VA": "",
+    "noise_IB": "",
+    "noise_VB": "",
+    "enob_IA": "",
+    "enob_VA": "",
+    "enob_IB": "",
+    "enob_VB": "",
     "rtc_set": false
   }, baseEndpoint + '/status');
 
@@ -104,6 +149,7 @@ function ConfigViewModel() {
     "mqtt_feed_prefix": "",
     "mqtt_user": "",
     "mqtt_pass": "",
+    "mqtt_json": "",
     "www_username": "",
     "www_password": "",
     "postInterval": "",
@@ -133,6 +179,23 @@ function ConfigViewModel() {
     "BattVoltsAlarmLow": "",
     "BattPeukert": "",
     "BattTempCo": "",
+    "capture_current_max": "",
+    "capture_voltage_min": "",
+    "capture_dvdt": "",
+    "sampleRate": "",
+    "oversampleA": "",
+    "oversampleB": "",
+    "oversampleFilter": "",
+    "schedule": "",
+    "filters": "",
+    "filterIirShift": "",
+    "filterNotchHz": "",
+    "autozero": "",
+    "autozeroIdleAmps": "",
+    "lowPower": "",
+    "wakingTime": "",
+    "sleepingTime": "",
+    "sleepPostEvery": "",
     "espflash": "",
     "version": "0.0.0"
   }, baseEndpoint + '/config');
@@ -148,24 +211,26 @@ function LastValuesViewModel() {
   self.fetching = ko.observable(false);
   self.values = ko.mapping.fromJS([]);
 
+  self.set = function (data) {
+    // Transform the data into something a bit easier to handle as a binding
+    var namevaluepairs = data.split(",");
+    var vals = [];
+    for (var z in namevaluepairs) {
+      var namevalue = namevaluepairs[z].split(":");
+      var units = "";
+      if (namevalue[0].indexOf("CT") === 0) units = "W";
+      //if (namevalue[0].indexOf("T") === 0) units = String.fromCharCode(176)+"C";
+      vals.push({key: namevalue[0], value: namevalue[1]+units});
+    }
+    ko.mapping.fromJS(vals, self.values);
+  };
+
   self.update = function (after) {
     if(after === undefined){
      after = function () { };
     }
     self.fetching(true);
-    $.get(self.remoteUrl, function (data) {
-      // Transform the data into something a bit easier to handle as a binding
-      var namevaluepairs = data.split(",");
-      var vals = [];
-      for (var z in namevaluepairs) {
-        var namevalue = namevaluepairs[z].split(":");
-        var units = "";
-        if (namevalue[0].indexOf("CT") === 0) units = "W";
-        //if (namevalue[0].indexOf("T") === 0) units = String.fromCharCode(176)+"C";
-        vals.push({key: namevalue[0], value: namevalue[1]+units});
-      }
-      ko.mapping.fromJS(vals, self.values);
-    }, 'text').always(function () {
+    $.get(self.remoteUrl, self.set, 'text').always(function () {
       self.fetching(false);
       after();
     });
@@ -182,28 +247,26 @@ function LogsViewModel() {
 
   let oldData = "";
 
+  self.add = function (data) {
+    if (data !== oldData) {
+      var logEntries = self.entries.slice();
+      logEntries.push({
+        timestamp: new Date().toISOString(),
+        log: data
+      });
+
+      ko.mapping.fromJS(logEntries, self.entries);
+      oldData = data;
+    }
+  };
+
   self.update = function (after) {
     if (after === undefined) {
       after = function () { };
     }
     self.fetching(true);
 
-    $.get(
-      self.remoteUrl,
-      function (data) {
-        if (data !== oldData) {
-          var logEntries = self.entries.slice();
-          logEntries.push({
-            timestamp: new Date().toISOString(),
-            log: data
-          });
-
-          ko.mapping.fromJS(logEntries, self.entries);
-          oldData = data;
-        }
-      },
-      "text"
-    ).always(function () {
+    $.get(self.remoteUrl, self.add, "text").always(function () {
       self.fetching(false);
       after();
     });
@@ -250,6 +313,77 @@ function StorageViewModel() {
   };
 }
 
+function CapturesViewModel() {
+  var self = this;
+  self.remoteUrl = baseEndpoint + '/captures';
+
+  self.fetching = ko.observable(false);
+  self.files = ko.mapping.fromJS([]);
+
+  self.update = function (after) {
+    if (after === undefined) {
+      after = function () { };
+    }
+    self.fetching(true);
+    $.get(self.remoteUrl, function (data) {
+      data = data.sort(function (left, right) {
+        return left.name < right.name ? 1 : -1;
+      });
+      ko.mapping.fromJS(data, self.files);
+    }, 'json').always(function () {
+      self.fetching(false);
+      after();
+    });
+  };
+}
+
+function CalPointsViewModel() {
+  var self = this;
+  self.remoteUrl = baseEndpoint + '/calibrate/points';
+
+  self.fetching = ko.observable(false);
+  self.points = ko.mapping.fromJS([]);
+  self.channel = ko.observable('IA');
+  self.value = ko.observable('');
+
+  self.update = function (after) {
+    if (after === undefined) {
+      after = function () { };
+    }
+    self.fetching(true);
+    $.get(self.remoteUrl, function (data) {
+      ko.mapping.fromJS(data, self.points);
+    }, 'json').always(function () {
+      self.fetching(false);
+      after();
+    });
+  };
+
+  self.post = function (args, failed) {
+    self.fetching(true);
+    $.post(baseEndpoint + '/calibrate/point', args, function (data) {
+      self.update();
+    }).fail(function (xhr) {
+      alert(failed + ": " + xhr.responseText);
+      self.fetching(false);
+    });
+  };
+
+  self.add = function () {
+    if (self.value() === '') {
+      alert("Enter what the reference meter reads");
+      return;
+    }
+    self.post({ channel: self.channel(), value: self.value() }, "Failed to add the point");
+  };
+
+  self.clear = function () {
+    if (confirm("Clear the points for " + self.channel() + "?")) {
+      self.post({ channel: self.channel(), clear: 1 }, "Failed to clear the points");
+    }
+  };
+}
+
 function EmonEspViewModel() {
   var self = this;
 
@@ -258,6 +392,8 @@ function EmonEspViewModel() {
   self.last = new LastValuesViewModel();
   self.logs = new LogsViewModel();
   self.storage = new StorageViewModel();
+  self.captures = new CapturesViewModel();
+  self.calpoints = new CalPointsViewModel();
   self.downloadFile = ko.observable('');
 
   self.initialised = ko.observable(false);
@@ -269,6 +405,10 @@ function EmonEspViewModel() {
   var logUpdateTimer = null;
   var logUpdateTime = 2000;
 
+  // Live updates come over the WebSocket, polling is only used while it is down.
+  var socket = null;
+  var socketRetryTime = 5000;
+
   // Upgrade URL
   self.upgradeUrl = ko.observable('about:blank');
 
@@ -283,9 +423,15 @@ function EmonEspViewModel() {
           self.initialised(true);
 
           self.storage.update();
+          self.captures.update();
+          self.calpoints.update();
+          self.status.capture_count.subscribe(function () {
+            self.captures.update();
+          });
 
           updateTimer = setTimeout(self.update, updateTime);
           logUpdateTimer = setTimeout(self.updateLogs, logUpdateTime);
+          self.connectSocket();
 
           // self.upgradeUrl(baseEndpoint + '/update');
           self.updating(false);
@@ -298,7 +444,7 @@ function EmonEspViewModel() {
   // Get the updated state from the ESP
   // -----------------------------------------------------------------------
   self.update = function () {
-    if (self.updating()) {
+    if (self.updating() || null !== socket) {
       return;
     }
     self.updating(true);
@@ -308,17 +454,11 @@ function EmonEspViewModel() {
     }
     self.status.update(function () 
     {
-      // Time is not set, set from our local time
-      if(false === self.status.rtc_set())
-      {
-        var newTime = new Date();
-        $.post(baseEndpoint + "/settime", {
-          "time": newTime.toISOString()
-        }, () => {
-        });
-      }
+      self.checkTime();
       self.last.update(function () {
-        updateTimer = setTimeout(self.update, updateTime);
+        if (null === socket) {
+          updateTimer = setTimeout(self.update, updateTime);
+        }
         self.updating(false);
       });
     });
@@ -329,11 +469,69 @@ function EmonEspViewModel() {
       clearTimeout(logUpdateTimer);
       logUpdateTimer = null;
     }
+    if (null !== socket) {
+      return;
+    }
     self.logs.update(function () {
-      logUpdateTimer = setTimeout(self.updateLogs, logUpdateTime);
+      if (null === socket) {
+        logUpdateTimer = setTimeout(self.updateLogs, logUpdateTime);
+      }
     });
   };
 
+  // Time is not set, set from our local time
+  self.checkTime = function () {
+    if(false === self.status.rtc_set())
+    {
+      var newTime = new Date();
+      $.post(baseEndpoint + "/settime", {
+        "time": newTime.toISOString()
+      }, () => {
+      });
+    }
+  };
+
+  // -----------------------------------------------------------------------
+  // WebSocket: {"values":"k:v,..."} and {"status":{changed fields}}
+  // -----------------------------------------------------------------------
+  self.connectSocket = function () {
+    var ws = new WebSocket(baseEndpoint.replace(/^http/, "ws") + "/ws");
+    ws.onopen = function () {
+      socket = ws;
+      clearTimeout(updateTimer);
+      clearTimeout(logUpdateTimer);
+      updateTimer = null;
+      logUpdateTimer = null;
+    };
+    ws.onmessage = function (event) {
+      var msg;
+      try {
+        msg = JSON.parse(event.data);
+      } catch (e) {
+        return;
+      }
+      if (msg.status !== undefined) {
+        ko.mapping.fromJS(msg.status, self.status);
+        if (msg.status.rtc_set !== undefined) {
+          self.checkTime();
+        }
+      }
+      if (msg.values !== undefined) {
+        self.last.set(msg.values);
+        self.logs.add(msg.values);
+      }
+    };
+    ws.onclose = function () {
+      if (socket === ws) {
+        // back to polling until the socket is back.
+        socket = null;
+        updateTimer = setTimeout(self.update, updateTime);
+        logUpdateTimer = setTimeout(self.updateLogs, logUpdateTime);
+      }
+      setTimeout(self.connectSocket, socketRetryTime);
+    };
+  };
+
   self.wifiConnecting = ko.observable(false);
   self.status.mode.subscribe(function (newValue) {
     if(newValue === "STA+AP" || newValue === "STA") {
@@ -388,7 +586,7 @@ function EmonEspViewModel() {
   self.saveEmonDC = function () {
     self.saveEmonDCFetching(true);
     self.saveEmonDCSuccess(false);
-    $.post(baseEndpoint + "/savedc", { interval: self.config.postInterval(), vcalA: self.config.vcalA(), icalA: self.config.icalA(), vcalB: self.config.vcalB(), icalB: self.config.icalB(),  chanA_VrefSet: self.config.chanA_VrefSet(), chanB_VrefSet: self.config.chanB_VrefSet(), channelA_gain: self.config.channelA_gain(), channelB_gain: self.config.channelB_gain(), R1_A: self.config.R1_A(), R2_A: self.config.R2_A(), R1_B: self.config.R1_B(), R2_B: self.config.R2_B(), Rshunt_A: self.config.Rshunt_A(), Rshunt_B: self.config.Rshunt_B(), AmpOffset_A: self.config.AmpOffset_A(), AmpOffset_B: self.config.AmpOffset_B(), VoltOffset_A: self.config.VoltOffset_A(), VoltOffset_B: self.config.VoltOffset_B(), BattType: self.config.BattType(), BattCapacity: self.config.BattCapacity(), BattCapHr: self.config.BattCapHr(), BattNom: self.config.BattNom(), BattVoltsAlarmHigh: self.config.BattVoltsAlarmHigh(), BattVoltsAlarmLow: self.config.BattVoltsAlarmLow(), BattPeukert: self.config.BattPeukert(), BattTempCo: self.config.BattTempCo() }, function (data) {
+    $.post(baseEndpoint + "/savedc", { interval: self.config.postInterval(), vcalA: self.config.vcalA(), icalA: self.config.icalA(), vcalB: self.config.vcalB(), icalB: self.config.icalB(),  chanA_VrefSet: self.config.chanA_VrefSet(), chanB_VrefSet: self.config.chanB_VrefSet(), channelA_gain: self.config.channelA_gain(), channelB_gain: self.config.channelB_gain(), R1_A: self.config.R1_A(), R2_A: self.config.R2_A(), R1_B: self.config.R1_B(), R2_B: self.config.R2_B(), Rshunt_A: self.config.Rshunt_A(), Rshunt_B: self.config.Rshunt_B(), AmpOffset_A: self.config.AmpOffset_A(), AmpOffset_B: self.config.AmpOffset_B(), VoltOffset_A: self.config.VoltOffset_A(), VoltOffset_B: self.config.VoltOffset_B(), BattType: self.config.BattType(), BattCapacity: self.config.BattCapacity(), BattCapHr: self.config.BattCapHr(), BattNom: self.config.BattNom(), BattVoltsAlarmHigh: self.config.BattVoltsAlarmHigh(), BattVoltsAlarmLow: self.config.BattVoltsAlarmLow(), BattPeukert: self.config.BattPeukert(), BattTempCo: self.config.BattTempCo(), sampleRate: self.config.sampleRate(), oversampleA: self.config.oversampleA(), oversampleB: self.config.oversampleB(), oversampleFilter: self.config.oversampleFilter(), schedule: self.config.schedule(), filters: self.config.filters(), filterIirShift: self.config.filterIirShift(), filterNotchHz: self.config.filterNotchHz(), autozero: self.config.autozero(), autozeroIdleAmps: self.config.autozeroIdleAmps(), lowPower: self.config.lowPower(), wakingTime: self.config.wakingTime(), sleepingTime: self.config.sleepingTime(), sleepPostEvery: self.config.sleepPostEvery() }, function (data) {
       self.saveEmonDCSuccess(true);
     }).fail(function () {
       alert("Failed to save config");
@@ -397,6 +595,23 @@ function EmonEspViewModel() {
     });
   };
 
+  // -----------------------------------------------------------------------
+  // Event: Zero the current offsets now
+  // -----------------------------------------------------------------------
+  self.zeroFetching = ko.observable(false);
+  self.zeroCurrents = function () {
+    if (!confirm("Disconnect or switch off every load and source on both channels, then press OK.")) {
+      return;
+    }
+    self.zeroFetching(true);
+    $.post(baseEndpoint + "/calibrate/zero", {}, function (data) {
+    }).fail(function () {
+      alert("Failed to start zeroing");
+    }).always(function () {
+      self.zeroFetching(false);
+    });
+  };
+
   // -----------------------------------------------------------------------
   // Event: Emoncms save
   // -----------------------------------------------------------------------
@@ -441,7 +656,8 @@ function EmonEspViewModel() {
       topic: self.config.mqtt_topic(),
       prefix: self.config.mqtt_feed_prefix(),
       user: self.config.mqtt_user(),
-      pass: self.config.mqtt_pass()
+      pass: self.config.mqtt_pass(),
+      json: self.config.mqtt_json()
     };
 
     if (mqtt.server === "") {
@@ -458,6 +674,29 @@ function EmonEspViewModel() {
       });
     }
   };
+
+  // -----------------------------------------------------------------------
+  // Event: Capture triggers save
+  // -----------------------------------------------------------------------
+  self.saveCaptureFetching = ko.observable(false);
+  self.saveCaptureSuccess = ko.observable(false);
+  self.saveCapture = function () {
+    var capture = {
+      current: self.config.capture_current_max(),
+      voltage: self.config.capture_voltage_min(),
+      dvdt: self.config.capture_dvdt()
+    };
+
+    self.saveCaptureFetching(true);
+    self.saveCaptureSuccess(false);
+    $.post(baseEndpoint + "/savecapture", capture, function (data) {
+      self.saveCaptureSuccess(true);
+    }).fail(function () {
+      alert("Failed to save capture triggers");
+    }).always(function () {
+      self.saveCaptureFetching(false);
+    });
+  };
 }
 
 $(function () {
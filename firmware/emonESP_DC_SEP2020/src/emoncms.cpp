@@ -27,8 +27,28 @@
 #include "emoncms.h"
 #include "config.h"
 #include "http.h"
+#include "http_reply.h"
+#include "measurement.h"
+#include "replay.h"
 
 #include <Arduino.h>
+#include <ESPAsyncTCP.h>
+
+// Plain HTTP posts go over one AsyncClient, kept open between posts and driven
+// from emoncms_loop(), so loop() is never held up waiting for the server.
+// A post stays at the head of the queue until emoncms answers "ok"; failures
+// back off and retry, and a full queue drops the oldest measurement.
+// HTTPS posts still use the blocking get_https(), the async TCP library is
+// built without TLS, so the SD backlog replay (replay.cpp) is HTTP only and is
+// held while an HTTPS server is set.
+
+#ifndef EMONCMS_QUEUE_SIZE
+#define EMONCMS_QUEUE_SIZE 16
+#endif
+#define EMONCMS_TIMEOUT_MS   5000UL
+#define EMONCMS_RETRY_MIN_MS 5000UL
+#define EMONCMS_RETRY_MAX_MS 300000UL
+#define EMONCMS_URL_SIZE     960
 
 //EMONCMS SERVER strings
 const char* e_url = "/input/post.json?json=";
@@ -37,54 +57,299 @@ boolean emoncms_connected = false;
 unsigned long packets_sent = 0;
 unsigned long packets_success = 0;
 unsigned long emoncms_connection_error_count = 0;
+unsigned long emoncms_dropped = 0;
+
+// measurements waiting to be posted, oldest first.
+static Measurement emoncms_queue[EMONCMS_QUEUE_SIZE];
+static uint8_t emoncms_queue_head = 0;
+static uint8_t emoncms_queue_count = 0;
+// test API and serial input, posted once, the latest only.
+static String emoncms_input;
+static bool emoncms_input_pending = false;
+
+enum emoncms_state_t { EMONCMS_IDLE, EMONCMS_CONNECTING, EMONCMS_WAITING, EMONCMS_DONE };
+static emoncms_state_t emoncms_state = EMONCMS_IDLE;
+static AsyncClient *emoncms_client = NULL;
+static char emoncms_host[48] = ""; // server the client is connected to.
+static char emoncms_url[EMONCMS_URL_SIZE];
+static http_reply_t emoncms_reply;
+static bool emoncms_ok = false;
+static bool emoncms_reuse = false;      // the reply was read to its end, the connection can take another post.
+enum emoncms_post_t { EMONCMS_POST_MEASUREMENT, EMONCMS_POST_INPUT, EMONCMS_POST_REPLAY };
+static emoncms_post_t emoncms_post = EMONCMS_POST_MEASUREMENT; // what is in flight.
+static bool emoncms_head_dropped = false;
+static uint32_t emoncms_post_time = 0;  // rtc time of the measurement in flight, 0 if it has none.
+static size_t emoncms_body_len = 0;     // replay post body, sent a row at a time.
+static uint16_t emoncms_body_row = 0;
+static size_t emoncms_piece_len = 0;
+static unsigned long emoncms_replayed_at = 0;
+static unsigned long emoncms_started = 0;
+static unsigned long emoncms_failed_at = 0;
+static unsigned long emoncms_backoff_ms = 0;
+
+
+//-------------------------
+// Queue
+//-------------------------
+void emoncms_publish_measurement(const Measurement &m)
+{
+  if (emoncms_queue_count == EMONCMS_QUEUE_SIZE) {
+    if (emoncms_state != EMONCMS_IDLE && emoncms_post == EMONCMS_POST_MEASUREMENT) emoncms_head_dropped = true;
+    emoncms_queue_head = (emoncms_queue_head + 1) % EMONCMS_QUEUE_SIZE;
+    emoncms_queue_count--;
+    emoncms_dropped++;
+  }
+  emoncms_queue[(emoncms_queue_head + emoncms_queue_count) % EMONCMS_QUEUE_SIZE] = m;
+  emoncms_queue_count++;
+}
 
-void emoncms_publish(String data)
+void emoncms_publish(const char *data)
 {
-  // We now create a URL for server data upload
-  String url = emoncms_path.c_str();
-  url += e_url;
-  url += "{";
-  // Copy across, data length
-  for (uint16_t i = 0; i < data.length(); ++i) {
-    url += data[i];
-  }
-  url += ",psent:";
-  url += packets_sent;
-  url += ",psuccess:";
-  url += packets_success;
-  url += ",freeram:";
-  url += String(ESP.getFreeHeap());
-  url += "}&node=";
-  url += emoncms_node;
-  url += "&apikey=";
-  url += emoncms_apikey;
-
-  DEBUG.println(url); //delay(10);
-  packets_sent++;
-
-  // Send data to Emoncms server
-  String result="";
-  if (emoncms_fingerprint!=0) {
-    // HTTPS on port 443 if HTTPS fingerprint is present
-    DEBUG.println("HTTPS Enabled"); //delay(10);
-    result = get_https(emoncms_fingerprint.c_str(), emoncms_server.c_str(), url, 443);
-  } else {
-    // Plain HTTP if other emoncms server e.g EmonPi
-    DEBUG.println("Plain old HTTP"); //delay(10);
-    result = get_http(emoncms_server.c_str(), url);
-  }
-  if (result == "ok") {
+  emoncms_input = data;
+  emoncms_input_pending = true;
+}
+
+uint8_t emoncms_queued()
+{
+  return emoncms_queue_count;
+}
+
+// Fill emoncms_url for the next post, false if it does not fit.
+static bool emoncms_build_url(void)
+{
+  emoncms_post_time = 0;
+  if (emoncms_post == EMONCMS_POST_REPLAY) {
+    // body length first, using the url buffer to format in.
+    emoncms_body_len = 0;
+    for (uint16_t row = 0; row < replay_batch(); row++) {
+      size_t len = replay_format(row, emoncms_url, EMONCMS_URL_SIZE);
+      if (len == 0) return false;
+      emoncms_body_len += len;
+    }
+    // time=0, the row times are unix times rather than offsets.
+    size_t len = snprintf(emoncms_url, EMONCMS_URL_SIZE, "%s/input/bulk.json?time=0&apikey=%s",
+                          emoncms_path.c_str(), emoncms_apikey.c_str());
+    return len < EMONCMS_URL_SIZE;
+  }
+
+  size_t len = snprintf(emoncms_url, EMONCMS_URL_SIZE, "%s%s{", emoncms_path.c_str(), e_url);
+  const Measurement *m = NULL;
+  if (emoncms_post == EMONCMS_POST_INPUT) {
+    len += snprintf(emoncms_url + len, EMONCMS_URL_SIZE - len, "%s", emoncms_input.c_str());
+  }
+  else {
+    m = &emoncms_queue[emoncms_queue_head];
+    if (EMONCMS_URL_SIZE - len < MEASUREMENT_TEXT_SIZE) return false;
+    len += measurement_format(*m, emoncms_url + len, EMONCMS_URL_SIZE - len);
+  }
+  if (len >= EMONCMS_URL_SIZE) return false;
+  len += snprintf(emoncms_url + len, EMONCMS_URL_SIZE - len, ",psent:%lu,psuccess:%lu,freeram:%lu}&node=%s&apikey=%s",
+                  packets_sent, packets_success, (unsigned long)ESP.getFreeHeap(),
+                  emoncms_node.c_str(), emoncms_apikey.c_str());
+  // a retried measurement keeps the time it was taken.
+  if (m && m->rtc_time && len < EMONCMS_URL_SIZE) {
+    emoncms_post_time = m->time;
+    len += snprintf(emoncms_url + len, EMONCMS_URL_SIZE - len, "&time=%lu", (unsigned long)m->time);
+  }
+  return len < EMONCMS_URL_SIZE;
+}
+
+// Remove the post that was in flight.
+static void emoncms_pop(void)
+{
+  if (emoncms_post == EMONCMS_POST_INPUT) {
+    emoncms_input_pending = false;
+  }
+  else if (emoncms_post == EMONCMS_POST_REPLAY) {
+    replay_batch_done();
+  }
+  else if (!emoncms_head_dropped && emoncms_queue_count > 0) {
+    emoncms_queue_head = (emoncms_queue_head + 1) % EMONCMS_QUEUE_SIZE;
+    emoncms_queue_count--;
+  }
+  emoncms_head_dropped = false;
+}
+
+// Take the post off the queue, or leave it there and back off.
+static void emoncms_result(bool ok)
+{
+  if (ok) {
+    if (boot_post_ms == 0) boot_post_ms = millis();
     packets_success++;
     emoncms_connected = true;
     emoncms_connection_error_count = 0;
+    emoncms_backoff_ms = 0;
   }
   else {
-    emoncms_connected=false;
+    emoncms_connected = false;
     DEBUG.print("Emoncms error: ");
-    DEBUG.println(result);
-    emoncms_connection_error_count ++;
-    if (emoncms_connection_error_count>30) {
-      ESP.restart();
+    if (emoncms_reply.status) {
+      DEBUG.print(emoncms_reply.status);
+      DEBUG.print(" ");
+    }
+    DEBUG.println(emoncms_reply.body_len ? emoncms_reply.body : "no reply");
+    emoncms_connection_error_count++;
+    emoncms_backoff_ms = emoncms_backoff_ms ? min(emoncms_backoff_ms * 2, EMONCMS_RETRY_MAX_MS) : EMONCMS_RETRY_MIN_MS;
+    emoncms_failed_at = millis();
+  }
+
+  if (ok && emoncms_post == EMONCMS_POST_MEASUREMENT && !emoncms_head_dropped && emoncms_post_time) {
+    replay_acknowledged(emoncms_post_time);
+  }
+  if (ok || emoncms_post == EMONCMS_POST_INPUT) emoncms_pop(); // input is not retried.
+  emoncms_head_dropped = false;
+}
+
+
+//-------------------------
+// Async client
+//-------------------------
+// Add as much of a replay body as there is room for, the rest goes as it is acknowledged.
+static void emoncms_send_body(AsyncClient *client)
+{
+  while (emoncms_body_row < replay_batch()) {
+    if (emoncms_piece_len == 0) emoncms_piece_len = replay_format(emoncms_body_row, emoncms_url, EMONCMS_URL_SIZE);
+    if (client->space() < emoncms_piece_len) break;
+    client->add(emoncms_url, emoncms_piece_len);
+    emoncms_piece_len = 0;
+    emoncms_body_row++;
+  }
+  client->send();
+}
+
+static void emoncms_send_request(AsyncClient *client)
+{
+  bool replay = (emoncms_post == EMONCMS_POST_REPLAY);
+  char header[200];
+  size_t url_len = strlen(emoncms_url);
+  size_t header_len = replay
+    ? snprintf(header, sizeof(header), " HTTP/1.1\r\nHost: %s\r\nContent-Type: application/x-www-form-urlencoded\r\n"
+               "Content-Length: %u\r\nConnection: keep-alive\r\n\r\n", emoncms_host, (unsigned int)emoncms_body_len)
+    : snprintf(header, sizeof(header), " HTTP/1.1\r\nHost: %s\r\nConnection: keep-alive\r\n\r\n", emoncms_host);
+  http_reply_begin(emoncms_reply);
+  if (header_len >= sizeof(header) || client->space() < url_len + header_len + 5) {
+    emoncms_ok = false;
+    emoncms_state = EMONCMS_DONE;
+    return;
+  }
+  client->add(replay ? "POST " : "GET ", replay ? 5 : 4);
+  client->add(emoncms_url, url_len);
+  client->add(header, header_len);
+  emoncms_state = EMONCMS_WAITING;
+  if (replay) {
+    emoncms_body_row = 0;
+    emoncms_piece_len = 0;
+    emoncms_send_body(client);
+  }
+  else {
+    client->send();
+  }
+}
+
+// The post's result, once the reply is in or the server closed on it.
+static void emoncms_reply_result(bool complete)
+{
+  emoncms_ok = complete && emoncms_reply.status == 200 && strstr(emoncms_reply.body, "ok") != NULL;
+  emoncms_reuse = complete && emoncms_reply.keep_alive;
+}
+
+static void emoncms_client_setup(void)
+{
+  emoncms_client = new AsyncClient();
+  emoncms_client->onConnect([](void *, AsyncClient *client) {
+    if (emoncms_state == EMONCMS_CONNECTING) emoncms_send_request(client);
+  });
+  emoncms_client->onData([](void *, AsyncClient *, void *data, size_t len) {
+    if (emoncms_state != EMONCMS_WAITING) return;
+    if (http_reply_feed(emoncms_reply, (const char *)data, len)) {
+      emoncms_reply_result(true);
+      emoncms_state = EMONCMS_DONE;
+    }
+  });
+  emoncms_client->onAck([](void *, AsyncClient *client, size_t, uint32_t) {
+    if (emoncms_state == EMONCMS_WAITING && emoncms_post == EMONCMS_POST_REPLAY) emoncms_send_body(client);
+  });
+  emoncms_client->onDisconnect([](void *, AsyncClient *) {
+    if (emoncms_state == EMONCMS_WAITING) {
+      emoncms_reply_result(http_reply_close(emoncms_reply));
+      emoncms_state = EMONCMS_DONE;
+    }
+    else if (emoncms_state == EMONCMS_CONNECTING) {
+      emoncms_ok = false;
+      emoncms_state = EMONCMS_DONE;
+    }
+  });
+  emoncms_client->onError([](void *, AsyncClient *, int8_t) {
+    if (emoncms_state == EMONCMS_CONNECTING || emoncms_state == EMONCMS_WAITING) {
+      emoncms_ok = false;
+      emoncms_reuse = false;
+      emoncms_state = EMONCMS_DONE;
+    }
+  });
+}
+
+// Start the next post, over the open connection if it is still to the same server.
+static void emoncms_start(void)
+{
+  emoncms_started = millis();
+  if (emoncms_client->connected() && strcmp(emoncms_host, emoncms_server.c_str()) == 0) {
+    emoncms_send_request(emoncms_client);
+    return;
+  }
+  if (emoncms_client->connected()) emoncms_client->close(true);
+  strlcpy(emoncms_host, emoncms_server.c_str(), sizeof(emoncms_host));
+  emoncms_state = EMONCMS_CONNECTING;
+  if (!emoncms_client->connect(emoncms_host, 80)) {
+    emoncms_ok = false;
+    emoncms_state = EMONCMS_DONE;
+  }
+}
+
+void emoncms_loop()
+{
+  if (!emoncms_client) emoncms_client_setup();
+
+  switch (emoncms_state) {
+  case EMONCMS_CONNECTING:
+  case EMONCMS_WAITING:
+    if (millis() - emoncms_started < EMONCMS_TIMEOUT_MS) break;
+    emoncms_ok = false;
+    emoncms_state = EMONCMS_DONE;
+    // fall through
+  case EMONCMS_DONE:
+    emoncms_state = EMONCMS_IDLE; // before close, so the disconnect is not taken for this post.
+    if (!emoncms_ok || !emoncms_reuse) emoncms_client->close(true);
+    emoncms_result(emoncms_ok);
+    break;
+  case EMONCMS_IDLE:
+    if (emoncms_backoff_ms && millis() - emoncms_failed_at < emoncms_backoff_ms) break;
+    // live data first, the backlog only when there is none and not too often.
+    if (emoncms_input_pending) emoncms_post = EMONCMS_POST_INPUT;
+    else if (emoncms_queue_count > 0) emoncms_post = EMONCMS_POST_MEASUREMENT;
+    else if (!replay_held() && millis() - emoncms_replayed_at >= REPLAY_INTERVAL_MS && replay_batch() > 0) {
+      emoncms_post = EMONCMS_POST_REPLAY;
+      emoncms_replayed_at = millis();
+    }
+    else break;
+    if (!emoncms_build_url()) {
+      DEBUG.println("Emoncms post too long, dropped");
+      emoncms_pop();
+      break;
+    }
+    if (emoncms_post != EMONCMS_POST_REPLAY) DEBUG.println(emoncms_url);
+    packets_sent++;
+    if (emoncms_fingerprint != 0) {
+      // HTTPS on port 443 if HTTPS fingerprint is present
+      String result = get_https(emoncms_fingerprint.c_str(), emoncms_server.c_str(), emoncms_url, 443);
+      http_reply_begin(emoncms_reply);
+      emoncms_reply.body_len = min(result.length(), (unsigned int)HTTP_REPLY_BODY_SIZE - 1);
+      strlcpy(emoncms_reply.body, result.c_str(), HTTP_REPLY_BODY_SIZE);
+      emoncms_result(result == "ok");
+    }
+    else {
+      // Plain HTTP if other emoncms server e.g EmonPi
+      emoncms_start();
     }
+    break;
   }
 }
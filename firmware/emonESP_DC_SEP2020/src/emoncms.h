@@ -37,11 +37,26 @@ extern unsigned long packets_sent;
 extern unsigned long packets_success;
 
 // -------------------------------------------------------------------
-// Publish values to EmonCMS
+// Publish values to EmonCMS, sent from emoncms_loop()
 //
 // data: a comma seperated list of name:value pairs to send
 // -------------------------------------------------------------------
-void emoncms_publish(String data);
+void emoncms_publish(const char *data);
+
+// -------------------------------------------------------------------
+// Queue a measurement for EmonCMS, kept and retried until it is accepted
+// -------------------------------------------------------------------
+struct Measurement;
+void emoncms_publish_measurement(const Measurement &m);
+
+// -------------------------------------------------------------------
+// Post queued data, call every time around loop() if connected to the WiFi
+// -------------------------------------------------------------------
+void emoncms_loop();
+
+// measurements waiting, and dropped when the queue was full.
+uint8_t emoncms_queued();
+extern unsigned long emoncms_dropped;
 
 #endif // _EMONESP_EMONCMS_H
 
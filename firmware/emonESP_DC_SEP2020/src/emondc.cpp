@@ -12,6 +12,19 @@
 #include "gpio0.h"
 #include "oled.h"
 #include "AH_MCP320x.h"
+#include "sampler.h"
+#include "calibration.h"
+#include "energy.h"
+#include "battery.h"
+#include "sdlog.h"
+#include "measurement.h"
+#include "replay.h"
+#include "stream.h"
+#include "capture.h"
+#include "oversample.h"
+#include "filter.h"
+#include "autozero.h"
+#include "simadc.h"
 
 #include <WiFiUdp.h>
 #include <NTPClient.h>
@@ -49,7 +62,7 @@ double icalA = 1.000; // CURRENT_A.
 double vcalA = 1.000; // VOLTAGE_A.
 double icalB = 1.000; // CURRENT_B.
 double vcalB = 1.000; // VOLTAGE_B.
-// Amplifier offset corrections for zero measurements, ideally these would be maps derived from experiment.
+// Amplifier offset corrections for zero measurements, autozero.cpp learns what is left on top of these.
 double AmpOffset_A = 0.00;
 double VoltOffset_A = 0.0;
 double AmpOffset_B = 0.0;
@@ -94,12 +107,13 @@ bool oled_button_flag = false; // if a button press is detected, the screen wil
 
 // SD CARD
 const int chipSelectSD = 15; // SD card chip SPI chip select
-SPISettings sdSettings(250000, MSBFIRST, SPI_MODE0); // 10kHz is the minimum clock speed : MCP3208 datasheet.
+SPISettings sdSettings(250000, MSBFIRST, SPI_MODE0);
 
-// sample rate in this sketch is around 450 samples per channel per second at 400kHz.
+// sample rate is set by sample_rate_hz, see sampler.cpp.
 // ADC
 const int chipSelectADC = 2; // SD card chip SPI chip select
-AH_MCP320x ADC_SPI(chipSelectADC, sdSettings); // ADC SPI chip select.
+SPISettings adcSettings(SAMPLER_ADC_HZ, MSBFIRST, SPI_MODE0); // 10kHz is the minimum clock speed : MCP3208 datasheet.
+AH_MCP320x ADC_SPI(chipSelectADC, adcSettings); // ADC SPI chip select.
 
 unsigned int _t_begin; //  human readable time of start
 unsigned long _t;//  human readable time since start
@@ -114,29 +128,36 @@ unsigned long VREF_BI_ACCUMULATOR = 0;
 unsigned long VREF33_ACCUMULATOR = 0;
 unsigned long CH8_ACCUMULATOR = 0;
 unsigned long numberofsamples = 0;
+unsigned long channel_samples[SAMPLER_CHANNELS]; // readings in each accumulator, see the sampler schedule.
 unsigned long numberofsamplesext = 0; // for outputting sample count before clearing accumulators.
 
-// MAX / MIN ADC channel values.
-uint16_t CH_A_CURRENT_MAX = 0;
-uint16_t CH_A_VOLTAGE_MAX = 0;
-uint16_t CH_B_CURRENT_MAX = 0;
-uint16_t CH_B_VOLTAGE_MAX = 0;
-uint16_t CH_A_CURRENT_MIN = 65000;
-uint16_t CH_A_VOLTAGE_MIN = 65000;
-uint16_t CH_B_CURRENT_MIN = 65000;
-uint16_t CH_B_VOLTAGE_MIN = 65000;
-
-// Averaged ADC channel values.
-double CH_A_CURRENT_AVERAGED;
-double CH_A_VOLTAGE_AVERAGED;
-double CH_B_CURRENT_AVERAGED;
-double CH_B_VOLTAGE_AVERAGED;
-double VREF_UNI_AVERAGED;
-double VREF_BI_AVERAGED;
-double VREF33_AVERAGED;
-double CH8_AVERAGED;
+// Pipeline cost, on /status. Per sample set drained (filters, accumulators,
+// energy, stream, capture), and per posting interval (averaging, calibration,
+// the measurement, the SD row and the hand over to the sinks).
+uint32_t loop_sample_cycles = 0;   // average over the last interval.
+uint32_t loop_interval_us = 0;
+uint32_t loop_interval_us_max = 0;
+float loop_samples_hz = 0;         // sample sets drained per second.
+uint32_t loop_heap_min = 0;        // least free heap seen after an interval.
+static uint64_t loop_drain_cycles = 0;
+static uint32_t loop_drained = 0;
+static unsigned long loop_clearedMillis = 0;
+
+// Averaged ADC channel values, counts in Q8 (1/256 LSB).
+int32_t CH_A_CURRENT_AVERAGED;
+int32_t CH_A_VOLTAGE_AVERAGED;
+int32_t CH_B_CURRENT_AVERAGED;
+int32_t CH_B_VOLTAGE_AVERAGED;
+int32_t VREF_UNI_AVERAGED;
+int32_t VREF_BI_AVERAGED;
+int32_t VREF33_AVERAGED;
+int32_t CH8_AVERAGED;
+int32_t CH_A_CURRENT_RAW_Q8; // before the reference is taken off, held when a channel is not read.
+int32_t CH_B_CURRENT_RAW_Q8;
 
 // Human-readable volts and amps
+double Ref_Uni;
+double Ref_Bi;
 double Voltage_A;
 double Current_A;
 double Voltage_B;
@@ -153,30 +174,12 @@ double Current_B_Min;
 //------------------------------
 // Battery variables
 //------------------------------
-double Ah_level_A = 0.0;
-double Ah_level_B = 0.0;
-double Ah_positive_A = 0.0;
-double Ah_positive_B = 0.0;
-double Ah_negative_A = 0.0;
-double Ah_negative_B = 0.0;
-
-// Wh variables
-double Wh_chA_positive = 0.0;
-double Wh_chB_positive = 0.0;
-double Wh_chA_negative = 0.0;
-double Wh_chB_negative = 0.0;
-
-// for converting the 3.3V reading into a useful calibration value, sets unit accuracy to the accuracy of the voltage regulator.
-double volts_to_adc_reading_ratio;
-// for storing the main string to be send to SD card and emonESP front-end and emonCMS.
-String ADC_KeyValue_String = ""; 
+// Wh and Ah totals live in energy.cpp, integrated per sample.
+
+// the readable values for SD card, emonESP front-end, emonCMS and MQTT are in last_measurement.
 // counting the number of posts.
 unsigned int averaging_loop_counter = 0;
 unsigned long number_of_posts = 0;
-// future use.
-bool low_power_mode = false;
-unsigned int waking_time = 6000;
-unsigned int sleeping_time = 10000;
 // battery and voltage alarm levels for future development.
 double Valarm_A_HIGH;
 double Valarm_A_LOW;
@@ -218,8 +221,8 @@ unsigned long intervalNTP = 60000;
 //------------------------------
 // SD CARD
 //------------------------------
-String datalogFilename = "datalog.csv";
-char datedFilename[15] = {"yyyy-mm-dd.csv"};
+String datalogFilename = "datalog.bin"; // binary logs, see sdlog.h. /sd/export?file=...&format=csv for CSV.
+char datedFilename[20] = {"yyyy-mm-dd.bin"}; // room for any uint16_t year.
 bool SD_present = false;
 
 
@@ -231,8 +234,6 @@ uint32_t main_interval_ms;
 unsigned long currentMillis;
 unsigned long previousMillis = 0;
 unsigned long previousPostingMillis = 0;
-// calibrate solar at midnight?
-bool midnight_calibration = false;
 bool OLED_active = 0;
 bool OLED_turnedoff = 0;
 int tmp_interval;
@@ -244,6 +245,7 @@ int tmp_interval;
 void emondc_setup(void) {
 
   main_interval_ms = main_interval_seconds * 1000; // called after JSON is loaded.
+  calibration_compile(); // integer scale factors from the loaded config.
 
   // microSD card init
   pinMode(chipSelectSD, OUTPUT);
@@ -253,22 +255,12 @@ void emondc_setup(void) {
   if (SD.begin(chipSelectSD, sdSettings)) { // SPI speed sey here. Clash possible with ADC. // esp8266 framework v2+
     Serial.println("SDcard initialised.");
     SD_present = true;
+    replay_setup(); // where emoncms got up to, for the backlog replay.
   }
   else {
     Serial.println("SD card not detected.");
   }
 
-  // OLED Display init
-  if (!display.begin(SSD1306_SWITCHCAPVCC, 0x3C)) Serial.println("SSD1306 allocation failed."); // Address 0x3C for 128x32
-  display.setRotation(2);
-  display.clearDisplay();
-  display.setTextSize(2);             // Normal 1:1 pixel scale
-  display.setTextColor(WHITE);        // Draw white text
-  display.setCursor(0, 0);            // Start at top-left corner
-  display.println(F("emonDCduo"));    // Initial print to OLED, version number.
-  display.println(hw_version);
-  display.display();
-  
   // RTC init
   if (!rtc.begin()) { Serial.println("RTC or I2C not functioning."); }
   else if (!rtc.initialized()) {
@@ -289,6 +281,29 @@ void emondc_setup(void) {
     timeConfidence = true;
   }
 
+#ifdef EMONDC_SIM_ADC
+  // the same waveforms and the same start time every run, until NTP has its say.
+  simadc_reset();
+  timeval sim_tv = {SIMADC_EPOCH, 0};
+  settimeofday(&sim_tv, NULL);
+  timeConfidence = true;
+#endif
+
+  // start the timer driven ADC sampling, SD init is done so the SPI bus is shared from here.
+  // the OLED splash and everything after it come second, the samples are already being taken.
+  sampler_setup();
+
+  // OLED Display init
+  if (!display.begin(SSD1306_SWITCHCAPVCC, 0x3C)) Serial.println("SSD1306 allocation failed."); // Address 0x3C for 128x32
+  display.setRotation(2);
+  display.clearDisplay();
+  display.setTextSize(2);             // Normal 1:1 pixel scale
+  display.setTextColor(WHITE);        // Draw white text
+  display.setCursor(0, 0);            // Start at top-left corner
+  display.println(F("emonDCduo"));    // Initial print to OLED, version number.
+  display.println(hw_version);
+  display.display();
+  
   // Start NTP time 
   timeClient.setTimeOffset(time_offset);
   timeClient.begin();
@@ -308,45 +323,32 @@ void emondc_setup(void) {
 //--------------------------------------------------
 void emondc_loop(void) {
   
-  uint16_t ch0_reading = ADC_SPI.readCH(0);
-  uint16_t ch1_reading = ADC_SPI.readCH(1);
-  uint16_t ch2_reading = ADC_SPI.readCH(2);
-  uint16_t ch3_reading = ADC_SPI.readCH(3);
-  uint16_t ch4_reading = ADC_SPI.readCH(4);
-  uint16_t ch5_reading = ADC_SPI.readCH(5);
-  uint16_t ch6_reading = ADC_SPI.readCH(6);
-  uint16_t ch7_reading = ADC_SPI.readCH(7);
-  
-  CH_A_CURRENT_ACCUMULATOR += ch0_reading;
-  CH_A_VOLTAGE_ACCUMULATOR += ch1_reading;
-  CH_B_CURRENT_ACCUMULATOR += ch2_reading;
-  CH_B_VOLTAGE_ACCUMULATOR += ch3_reading;
-  VREF_BI_ACCUMULATOR      += ch4_reading;
-  VREF_UNI_ACCUMULATOR     += ch5_reading;
-  VREF33_ACCUMULATOR       += ch6_reading;
-  CH8_ACCUMULATOR          += ch7_reading;
-  
-  // store maximum and minimum values.
-  if (ch0_reading > CH_A_CURRENT_MAX) CH_A_CURRENT_MAX = ch0_reading;
-  if (ch1_reading > CH_A_VOLTAGE_MAX) CH_A_VOLTAGE_MAX = ch1_reading;
-  if (ch2_reading > CH_B_CURRENT_MAX) CH_B_CURRENT_MAX = ch2_reading;
-  if (ch3_reading > CH_B_VOLTAGE_MAX) CH_B_VOLTAGE_MAX = ch3_reading;
-  if (ch0_reading < CH_A_CURRENT_MIN) CH_A_CURRENT_MIN = ch0_reading;
-  if (ch1_reading < CH_A_VOLTAGE_MIN) CH_A_VOLTAGE_MIN = ch1_reading;
-  if (ch2_reading < CH_B_CURRENT_MIN) CH_B_CURRENT_MIN = ch2_reading;
-  if (ch3_reading < CH_B_VOLTAGE_MIN) CH_B_VOLTAGE_MIN = ch3_reading;
-  
-  numberofsamples++;
+  // drain the samples taken by the timer ISR since the last pass.
+  adc_sample_t sample;
+  uint32_t drain_start = ESP.getCycleCount();
+  uint32_t drained = 0;
+  while (sampler_read(sample)) {
+    if (boot_sample_ms == 0) boot_sample_ms = millis();
+    accumulate_sample(sample.ch, sample.fresh);
+    stream_sample(sample.ch); // raw samples to a WebSocket client, when one asked.
+    if (SD_present) capture_sample(sample.ch); // pre-trigger ring, see capture.cpp.
+    drained++;
+  }
+  if (drained) {
+    loop_drain_cycles += ESP.getCycleCount() - drain_start;
+    loop_drained += drained;
+  }
 
   currentMillis = millis();
   yield();
-  if (currentMillis - previousMillis >= readings_interval*1000 && numberofsamples >= 500) {
+  if (currentMillis - previousMillis >= readings_interval*1000 && numberofsamples >= (sample_rate_hz * readings_interval) / 2) {
     //overrunMillis = currentMillis % main_interval_ms;
     uint32_t _previousMillis = previousMillis;
     previousMillis = currentMillis;
     //previousMillis = previousMillis - overrunMillis;
     NTPupdate_RTCupdate();  // update RTC time, via network if available every 60s.   
 
+    unsigned long interval_start = micros();
     yield();
     average_and_calibrate(_previousMillis, currentMillis); // readying the readable values, passing necessary time values associated with the posting intervals.
     yield();
@@ -369,13 +371,28 @@ void emondc_loop(void) {
       //-----------------------------------
       yield();
       //-----------------------------------
-      numberofsamplesext;
       Serial.print("number of posts: ");  Serial.println(number_of_posts); // for debugging
       Serial.print("FreeRAM (bytes): ");  Serial.println(ESP.getFreeHeap()); // for debugging
+
+      loop_samples_hz = currentMillis != loop_clearedMillis ? loop_drained * 1000.0 / (currentMillis - loop_clearedMillis) : 0;
+      loop_clearedMillis = currentMillis;
+      loop_sample_cycles = loop_drained ? loop_drain_cycles / loop_drained : 0;
+      loop_drain_cycles = 0;
+      loop_drained = 0;
       clear_accumulators();
     }
+    // the Serial prints above are part of the cost, as they are in use.
+    loop_interval_us = micros() - interval_start;
+    if (loop_interval_us > loop_interval_us_max) loop_interval_us_max = loop_interval_us;
+    uint32_t heap = ESP.getFreeHeap();
+    if (loop_heap_min == 0 || heap < loop_heap_min) loop_heap_min = heap;
   }
   
+  if (SD_present) sdlog_loop(); // staged SD rows, written when the buffer fills or they get old.
+  if (SD_present) replay_loop();
+  autozero_loop(); // learned zeros to EEPROM, hourly at most.
+  if (SD_present) capture_loop(); // a triggered capture to the card, a block per pass.
+
   //--------------------------------------
   //OLED TIMER
   //--------------------------------------
@@ -401,58 +418,121 @@ void emondc_loop(void) {
 } // end emonDC loop
 
 
+//--------------------------------------------------
+// Clean shutdown, call before a restart or reset.
+//--------------------------------------------------
+void emondc_shutdown(void) {
+  if (SD_present) sdlog_close(); // staged log rows to the card.
+  if (SD_present) replay_save();
+  energy_save(); // totals since the last hourly save.
+}
+
+
+//--------------------------------------------------
+// Add one set of channel readings to the accumulators.
+//--------------------------------------------------
+// Only the channels read on this pass (fresh) are added, each accumulator
+// keeps its own count, the others hold their last reading for the per sample
+// energy and the stream. The filters run first, on a copy; the energy is
+// integrated from the raw readings, see filter.h.
+void accumulate_sample(const uint16_t *raw, uint8_t fresh) {
+  uint16_t readings[SAMPLER_CHANNELS];
+  memcpy(readings, raw, sizeof(readings));
+  filter_apply(readings, fresh); // spikes out before the sums and max/min, see filter.h.
+
+  if (fresh & 0x01) CH_A_CURRENT_ACCUMULATOR += readings[0];
+  if (fresh & 0x02) CH_A_VOLTAGE_ACCUMULATOR += readings[1];
+  if (fresh & 0x04) CH_B_CURRENT_ACCUMULATOR += readings[2];
+  if (fresh & 0x08) CH_B_VOLTAGE_ACCUMULATOR += readings[3];
+  if (fresh & 0x10) VREF_BI_ACCUMULATOR      += readings[4];
+  if (fresh & 0x20) VREF_UNI_ACCUMULATOR     += readings[5];
+  if (fresh & 0x40) VREF33_ACCUMULATOR       += readings[6];
+  if (fresh & 0x80) CH8_ACCUMULATOR          += readings[7];
+  for (uint8_t ch = 0; ch < SAMPLER_CHANNELS; ch++) {
+    if (fresh & (1 << ch)) channel_samples[ch]++;
+  }
+  
+  numberofsamples++;
+
+  oversample_sample(readings, fresh); // decimated outputs for the max and min values.
+
+  energy_accumulate(raw); // true Wh and Ah, V x I per sample, ripple and all.
+}
+
+
+//--------------------------------------------------
+// Accumulator average in Q8 counts (1/256 LSB), previous if the channel was not read.
+//--------------------------------------------------
+int32_t average_q8(unsigned long accumulator, uint8_t channel, int32_t previous) {
+  if (channel_samples[channel] == 0) return previous;
+  return (int32_t)(((uint64_t)accumulator << 8) / channel_samples[channel]);
+}
+
+
 //----------------------------------------------------------------------------------------------------
 // Create averaged values from ADC channels, apply calibration, make readable amps and volts.
 //----------------------------------------------------------------------------------------------------
 void average_and_calibrate(unsigned long pre_mills, unsigned long curr_mills) {
-  // create averaged values from the sample accumulators.
-  CH_A_CURRENT_AVERAGED = CH_A_CURRENT_ACCUMULATOR / numberofsamples;
-  CH_A_VOLTAGE_AVERAGED = CH_A_VOLTAGE_ACCUMULATOR / numberofsamples;
-  CH_B_CURRENT_AVERAGED = CH_B_CURRENT_ACCUMULATOR / numberofsamples;
-  CH_B_VOLTAGE_AVERAGED = CH_B_VOLTAGE_ACCUMULATOR / numberofsamples;
-  VREF_UNI_AVERAGED = VREF_UNI_ACCUMULATOR / numberofsamples;
-  VREF_BI_AVERAGED = VREF_BI_ACCUMULATOR / numberofsamples;
-  VREF33_AVERAGED = VREF33_ACCUMULATOR / numberofsamples;
-  CH8_AVERAGED = CH8_ACCUMULATOR / numberofsamples;
-
-  // adjust current readings according to Vref values, i.e. reference offset removal.
-  if (chanA_VrefSet == 0) CH_A_CURRENT_AVERAGED -= VREF_UNI_AVERAGED;
-  else CH_A_CURRENT_AVERAGED -= VREF_BI_AVERAGED;
-  if (chanB_VrefSet == 0) CH_B_CURRENT_AVERAGED -= VREF_UNI_AVERAGED;
-  else CH_B_CURRENT_AVERAGED -= VREF_BI_AVERAGED;
-
-  volts_to_adc_reading_ratio = volts_to_adc_reading_ratio_function(); // convert VREF33 into 'ADCvalue to Voltage factor'
+  // create averaged values from the sample accumulators, keeping 8 fractional bits.
+  // the currents have the reference taken off below, so they restart from raw counts.
+  CH_A_CURRENT_AVERAGED = average_q8(CH_A_CURRENT_ACCUMULATOR, 0, CH_A_CURRENT_RAW_Q8);
+  CH_A_VOLTAGE_AVERAGED = average_q8(CH_A_VOLTAGE_ACCUMULATOR, 1, CH_A_VOLTAGE_AVERAGED);
+  CH_B_CURRENT_AVERAGED = average_q8(CH_B_CURRENT_ACCUMULATOR, 2, CH_B_CURRENT_RAW_Q8);
+  CH_B_VOLTAGE_AVERAGED = average_q8(CH_B_VOLTAGE_ACCUMULATOR, 3, CH_B_VOLTAGE_AVERAGED);
+  VREF_BI_AVERAGED = average_q8(VREF_BI_ACCUMULATOR, 4, VREF_BI_AVERAGED);
+  VREF_UNI_AVERAGED = average_q8(VREF_UNI_ACCUMULATOR, 5, VREF_UNI_AVERAGED);
+  VREF33_AVERAGED = average_q8(VREF33_ACCUMULATOR, 6, VREF33_AVERAGED);
+  CH8_AVERAGED = average_q8(CH8_ACCUMULATOR, 7, CH8_AVERAGED);
+  CH_A_CURRENT_RAW_Q8 = CH_A_CURRENT_AVERAGED;
+  CH_B_CURRENT_RAW_Q8 = CH_B_CURRENT_AVERAGED;
+
+  // current channel reference, i.e. reference offset removal.
+  int32_t ref_A = (chanA_VrefSet == 0) ? VREF_UNI_AVERAGED : VREF_BI_AVERAGED;
+  int32_t ref_B = (chanB_VrefSet == 0) ? VREF_UNI_AVERAGED : VREF_BI_AVERAGED;
+  CH_A_CURRENT_AVERAGED -= ref_A;
+  CH_B_CURRENT_AVERAGED -= ref_B;
+
+  calibration_set_vref(VREF33_AVERAGED); // the 3.3V reading sets unit accuracy to the accuracy of the voltage regulator.
+  capture_compile(ref_A, ref_B); // capture triggers follow the new scale and references.
   yield();
-  // make readable voltage and current values, apply calibration.
-  Current_A = make_readable_Amps(CH_A_CURRENT_AVERAGED, 0, channelA_gain) * icalA;
-  Voltage_A = make_readable_Volts(CH_A_VOLTAGE_AVERAGED, 0) * vcalA;
-  Current_B = make_readable_Amps(CH_B_CURRENT_AVERAGED, 1, channelB_gain) * icalB;
-  Voltage_B = make_readable_Volts(CH_B_VOLTAGE_AVERAGED, 1) * vcalB;
+  // make readable voltage and current values, calibration is folded into the integer scale.
+  Current_A = calibration_apply(CAL_CURRENT_A, CH_A_CURRENT_AVERAGED) * 1e-6;
+  Voltage_A = calibration_apply(CAL_VOLTAGE_A, CH_A_VOLTAGE_AVERAGED) * 1e-6;
+  Current_B = calibration_apply(CAL_CURRENT_B, CH_B_CURRENT_AVERAGED) * 1e-6;
+  Voltage_B = calibration_apply(CAL_VOLTAGE_B, CH_B_VOLTAGE_AVERAGED) * 1e-6;
+  Ref_Uni = calibration_apply(CAL_REF, VREF_UNI_AVERAGED) * 1e-6;
+  Ref_Bi = calibration_apply(CAL_REF, VREF_BI_AVERAGED) * 1e-6;
   //Current_B -= 20.0; // testing
 
-  Current_A_Max = make_readable_Amps(CH_A_CURRENT_MAX, 0, channelA_gain) * icalA;
-  Voltage_A_Max = make_readable_Volts(CH_A_VOLTAGE_MAX, 0) * vcalA;
-  Current_B_Max = make_readable_Amps(CH_B_CURRENT_MAX, 1, channelB_gain) * icalB;
-  Voltage_B_Max = make_readable_Volts(CH_B_VOLTAGE_MAX, 1) * vcalB;
-  Current_A_Min = make_readable_Amps(CH_A_CURRENT_MIN, 0, channelA_gain) * icalA;
-  Voltage_A_Min = make_readable_Volts(CH_A_VOLTAGE_MIN, 0) * vcalA;
-  Current_B_Min = make_readable_Amps(CH_B_CURRENT_MIN, 1, channelB_gain) * icalB;
-  Voltage_B_Min = make_readable_Volts(CH_B_VOLTAGE_MIN, 1) * vcalB;
-
+  // max and min of the decimated outputs, see oversample.h.
+  oversample_finish();
+  const oversample_stats_t *os = oversample_stats;
+  Current_A_Max = calibration_apply(CAL_CURRENT_A, os[0].max_q8 - ref_A) * 1e-6;
+  Voltage_A_Max = calibration_apply(CAL_VOLTAGE_A, os[1].max_q8) * 1e-6;
+  Current_B_Max = calibration_apply(CAL_CURRENT_B, os[2].max_q8 - ref_B) * 1e-6;
+  Voltage_B_Max = calibration_apply(CAL_VOLTAGE_B, os[3].max_q8) * 1e-6;
+  Current_A_Min = calibration_apply(CAL_CURRENT_A, os[0].min_q8 - ref_A) * 1e-6;
+  Voltage_A_Min = calibration_apply(CAL_VOLTAGE_A, os[1].min_q8) * 1e-6;
+  Current_B_Min = calibration_apply(CAL_CURRENT_B, os[2].min_q8 - ref_B) * 1e-6;
+  Voltage_B_Min = calibration_apply(CAL_VOLTAGE_B, os[3].min_q8) * 1e-6;
+
+  // zero offsets from idle periods or a /calibrate/zero command, used from the next interval.
+  int32_t zero_counts[4] = {CH_A_CURRENT_AVERAGED, CH_A_VOLTAGE_AVERAGED, CH_B_CURRENT_AVERAGED, CH_B_VOLTAGE_AVERAGED};
+  double zero_amps[2] = {Current_A, Current_B};
+  autozero_interval(zero_counts, zero_amps);
   
   unsigned long this_interval_ms = curr_mills - pre_mills;
   yield();
-  double Ah_period = (Current_B * (this_interval_ms/1000)) / 3600.0; // Coulomb count this period.
-  double soc_diff = Ah_period / effective_capacity_fromfull(); // state of charge difference this period.
-  state_of_charge += soc_diff; // update state of charge.
-  if (state_of_charge > 1.0) state_of_charge = 1.0;
-  // C *= state_of_charge; don't adjust this on the fly because of it's effect of peukert equation.
+  energy_update(this_interval_ms); // Coulomb count this period, from the per-sample integration.
+  state_of_charge = battery_estimate(battery_params(), battery_state, state_of_charge, Current_B, Voltage_B,
+                                     Ah_period_B, (this_interval_ms + 500) / 1000); // see battery.cpp.
   if (state_of_charge == 1.0) time_until_discharged = 0;
   else time_until_discharged = time_until_discharged_fromfull() * 3600  * state_of_charge;
   if (time_until_discharged < 0) time_until_discharged *= -1;
   if (Current_B > 0) time_until_discharged = 0;
 
   yield();
+  measurement_update();
   
   averaging_loop_counter++;
   //Serial.print("Averaging: ");
@@ -471,97 +551,60 @@ void clear_accumulators(void) {
   CH8_ACCUMULATOR = 0;
   numberofsamplesext = numberofsamples;
   numberofsamples = 0;
+  memset(channel_samples, 0, sizeof(channel_samples));
+  filter_finish(); // per sample filter cost for /status.
+  if (!sampler_finish()) {
+    Serial.print("sampler passes too slow, sample_rate_hz lowered to: "); Serial.println(sample_rate_hz);
+  }
+  sampler_request_once(); // CH8 and anything else read once per interval.
 
-  CH_A_CURRENT_MAX = 0;
-  CH_A_VOLTAGE_MAX = 0;
-  CH_B_CURRENT_MAX = 0;
-  CH_B_VOLTAGE_MAX = 0;
-  CH_A_CURRENT_MIN = 65000;
-  CH_A_VOLTAGE_MIN = 65000;
-  CH_B_CURRENT_MIN = 65000;
-  CH_B_VOLTAGE_MIN = 65000;
+  oversample_reset();
 }
 
 //---------------------------------------------------------------------------
-// Build Strign to forward to emonESP, same string is stored to SD card.
+// Fill the measurement record from the readable values, once per interval.
+//---------------------------------------------------------------------------
+void measurement_update(void) {
+  Measurement &m = last_measurement;
+  m.rtc_time = timeConfidence;
+  m.time = timeConfidence ? rtc_unixtime : (millis() / 1000) - _t_begin;
+
+  m.value[MEAS_VOLTS_A] = measurement_fixed(MEAS_VOLTS_A, Voltage_A);
+  m.value[MEAS_VOLTS_A_MAX] = measurement_fixed(MEAS_VOLTS_A_MAX, Voltage_A_Max);
+  m.value[MEAS_VOLTS_A_MIN] = measurement_fixed(MEAS_VOLTS_A_MIN, Voltage_A_Min);
+  m.value[MEAS_AMPS_A] = measurement_fixed(MEAS_AMPS_A, Current_A);
+  m.value[MEAS_AMPS_A_MAX] = measurement_fixed(MEAS_AMPS_A_MAX, Current_A_Max);
+  m.value[MEAS_AMPS_A_MIN] = measurement_fixed(MEAS_AMPS_A_MIN, Current_A_Min);
+  m.value[MEAS_VOLTS_B] = measurement_fixed(MEAS_VOLTS_B, Voltage_B);
+  m.value[MEAS_VOLTS_B_MAX] = measurement_fixed(MEAS_VOLTS_B_MAX, Voltage_B_Max);
+  m.value[MEAS_VOLTS_B_MIN] = measurement_fixed(MEAS_VOLTS_B_MIN, Voltage_B_Min);
+  m.value[MEAS_AMPS_B] = measurement_fixed(MEAS_AMPS_B, Current_B);
+  m.value[MEAS_AMPS_B_MAX] = measurement_fixed(MEAS_AMPS_B_MAX, Current_B_Max);
+  m.value[MEAS_AMPS_B_MIN] = measurement_fixed(MEAS_AMPS_B_MIN, Current_B_Min);
+  m.value[MEAS_REF_UNI] = measurement_fixed(MEAS_REF_UNI, Ref_Uni);
+  m.value[MEAS_REF_BI] = measurement_fixed(MEAS_REF_BI, Ref_Bi);
+  m.value[MEAS_CH8] = measurement_fixed(MEAS_CH8, CH8_AVERAGED / 256.0);
+  m.value[MEAS_SOC] = measurement_fixed(MEAS_SOC, state_of_charge * 100);
+  m.value[MEAS_TIMEUD] = measurement_fixed(MEAS_TIMEUD, time_until_discharged / 3600);
+  m.value[MEAS_WH_IN_A] = measurement_fixed(MEAS_WH_IN_A, Wh_chA_positive);
+  m.value[MEAS_WH_OUT_A] = measurement_fixed(MEAS_WH_OUT_A, Wh_chA_negative);
+  m.value[MEAS_AH_IN_A] = measurement_fixed(MEAS_AH_IN_A, Ah_positive_A);
+  m.value[MEAS_AH_OUT_A] = measurement_fixed(MEAS_AH_OUT_A, Ah_negative_A);
+  m.value[MEAS_WH_IN_B] = measurement_fixed(MEAS_WH_IN_B, Wh_chB_positive);
+  m.value[MEAS_WH_OUT_B] = measurement_fixed(MEAS_WH_OUT_B, Wh_chB_negative);
+  m.value[MEAS_AH_IN_B] = measurement_fixed(MEAS_AH_IN_B, Ah_positive_B);
+  m.value[MEAS_AH_OUT_B] = measurement_fixed(MEAS_AH_OUT_B, Ah_negative_B);
+  m.value[MEAS_SAMPLECOUNT] = numberofsamples;
+}
+
+
+//---------------------------------------------------------------------------
+// Hand the measurement to emonESP, the loop() posts it to emonCMS and MQTT.
 //---------------------------------------------------------------------------
 void forward_to_emonESP(void)
 {
-/*
-  double Voltage_A_Max;
-  double Current_A_Max;
-  double Voltage_B_Max;
-  double Current_B_Max;
-
-  double Voltage_A_Min;
-  double Current_A_Min;
-  double Voltage_B_Min;
-  double Current_B_Min;
-*/
-
-  ADC_KeyValue_String = "Volts_A:" + String(Voltage_A, 2);
-  ADC_KeyValue_String += ",";
-  ADC_KeyValue_String += "Volts_A_Max:";
-  ADC_KeyValue_String += Voltage_A_Max;
-  ADC_KeyValue_String += ",";
-  ADC_KeyValue_String += "Volts_A_Min:";
-  ADC_KeyValue_String += Voltage_A_Min;
-  ADC_KeyValue_String += ",";
-  ADC_KeyValue_String += "Amps_A:";
-  ADC_KeyValue_String += Current_A;
-  ADC_KeyValue_String += ",";
-  ADC_KeyValue_String += "Amps_A_Max:";
-  ADC_KeyValue_String += Current_A_Max;
-  ADC_KeyValue_String += ",";
-  ADC_KeyValue_String += "Amps_A_Min:";
-  ADC_KeyValue_String += Current_A_Min;
-  ADC_KeyValue_String += ",";
-  ADC_KeyValue_String += "Volts_B:";
-  ADC_KeyValue_String += Voltage_B;
-  ADC_KeyValue_String += ",";
-  ADC_KeyValue_String += "Volts_B_Max:";
-  ADC_KeyValue_String += Voltage_B_Max;
-  ADC_KeyValue_String += ",";
-  ADC_KeyValue_String += "Volts_B_Min:";
-  ADC_KeyValue_String += Voltage_B_Min;
-  ADC_KeyValue_String += ",";
-  ADC_KeyValue_String += "Amps_B:";
-  ADC_KeyValue_String += Current_B;
-  ADC_KeyValue_String += ",";
-  ADC_KeyValue_String += "Amps_B_Max:";
-  ADC_KeyValue_String += Current_B_Max;
-  ADC_KeyValue_String += ",";
-  ADC_KeyValue_String += "Amps_B_Min:";
-  ADC_KeyValue_String += Current_B_Min;
-  ADC_KeyValue_String += ",";
-  ADC_KeyValue_String += "Ref_Uni:";
-  ADC_KeyValue_String += (VREF_UNI_AVERAGED * volts_to_adc_reading_ratio);
-  ADC_KeyValue_String += ",";
-  ADC_KeyValue_String += "Ref_Bi:";
-  ADC_KeyValue_String += (VREF_BI_AVERAGED * volts_to_adc_reading_ratio);
-  ADC_KeyValue_String += ",";
-  ADC_KeyValue_String += "CH8:";
-  ADC_KeyValue_String += CH8_AVERAGED;
-  ADC_KeyValue_String += ",";
-  ADC_KeyValue_String += "SoC(%):";
-  ADC_KeyValue_String += (state_of_charge*100);
-  ADC_KeyValue_String += ",";
-  ADC_KeyValue_String += "TimeUD(h):";
-  ADC_KeyValue_String += time_until_discharged/3600;
-  ADC_KeyValue_String += ",";
-  ADC_KeyValue_String += "samplecount:";
-  ADC_KeyValue_String += numberofsamples;
-  ADC_KeyValue_String += ",";
-  if (timeConfidence) {
-    ADC_KeyValue_String += "rtcTime:";
-    ADC_KeyValue_String += rtc_unixtime;
-  }
-  else {
-    ADC_KeyValue_String += "runTime:";
-    ADC_KeyValue_String += _t;
-  }
-  
-  input_string = ADC_KeyValue_String;
+  measurement_format(last_measurement, measurement_text, sizeof(measurement_text));
+  measurement_pending = true;
 
   number_of_posts++;
 }
@@ -572,6 +615,7 @@ void forward_to_emonESP(void)
 //-------------------------
 void draw_OLED() {
   oled_previousMillis = currentMillis;
+  const Measurement &m = last_measurement;
   
 
   if (screentog == -1) {
@@ -598,18 +642,18 @@ void draw_OLED() {
 
   if (screentog == 0) {
     jumpback_oled:
-    display.print(F("Ch A | ")); display.print(Voltage_A,3); display.println(F(" Volts"));
-    display.print(F("     | ")); display.print(Current_A,3); display.println(F(" Amps"));
-    display.print(F("Ch B | ")); display.print(Voltage_B,3); display.println(F(" Volts"));
-    display.print(F("     | ")); display.print(Current_B,3); display.println(F(" Amps"));
+    display.print(F("Ch A | ")); display.print(measurement_value(m, MEAS_VOLTS_A),3); display.println(F(" Volts"));
+    display.print(F("     | ")); display.print(measurement_value(m, MEAS_AMPS_A),3); display.println(F(" Amps"));
+    display.print(F("Ch B | ")); display.print(measurement_value(m, MEAS_VOLTS_B),3); display.println(F(" Volts"));
+    display.print(F("     | ")); display.print(measurement_value(m, MEAS_AMPS_B),3); display.println(F(" Amps"));
     if (!OLED_active) screentog++;
   }
   else if (screentog == 1) {
     display.println(F("State of Charge")); 
-    display.print(F("  ")); display.print((state_of_charge*100.0),0); display.println(F(" %"));
+    display.print(F("  ")); display.print(measurement_value(m, MEAS_SOC),0); display.println(F(" %"));
     display.println(F("Time to Discharged")); 
     display.print(F("  "));
-    float hours_until_discharged = time_until_discharged / 3600.0;
+    float hours_until_discharged = measurement_value(m, MEAS_TIMEUD);
     if (hours_until_discharged > 0 || hours_until_discharged < 2000) {
      display.print(hours_until_discharged,1); display.println(F(" hour(s)"));
     }
@@ -641,10 +685,10 @@ void draw_OLED() {
     if (!OLED_active) screentog++;
   }
   else if (screentog == 3) { // hyteresis management, for clearer info display // user sets manual hysteresis?
-    if (Current_B > 0.2) {
+    if (m.value[MEAS_AMPS_B] > measurement_fixed(MEAS_AMPS_B, 0.2)) {
       display.drawBitmap(0, 0, charging_bmp, IMAGE_WIDTH, IMAGE_HEIGHT, 1);
     }
-    else if (Current_B < -0.2) {
+    else if (m.value[MEAS_AMPS_B] < measurement_fixed(MEAS_AMPS_B, -0.2)) {
       display.drawBitmap(0, 0, discharging_bmp, IMAGE_WIDTH, IMAGE_HEIGHT, 1);
     }
     else {screentog = 0; goto jumpback_oled;}
@@ -690,149 +734,29 @@ void NTPupdate_RTCupdate(void) {
 }
 
 
-//--------------------------------------------------
-// ADC averaged 3.3V reading to volts per 12-bit ADC division
-//--------------------------------------------------
-double volts_to_adc_reading_ratio_function(void) {
-  double _volts_to_adc_reading_ratio = 3.3000 / VREF33_AVERAGED;
-  return (_volts_to_adc_reading_ratio);
-}
-
-
-//--------------------------------------------------
-// ADC averaged value to Volts
-//--------------------------------------------------
-//double Vcal_coefficient_A = ((double)R2_A / ((double)R1_A + (double)R2_A)); // resistor divider calc.
-//double Vcal_coefficient_B = ((double)R2_B / ((double)R1_B + (double)R2_B)); // resistor divider calc.
-
-double make_readable_Volts (double _Value, bool _chan) {
-
-  double _readableV1 = _Value * volts_to_adc_reading_ratio;
-
-  if (_chan == 0) {
-    double _readableVolts = _readableV1 / ((double)R2_A / ((double)R1_A + (double)R2_A));
-    _readableVolts += VoltOffset_A;
-    return (_readableVolts);
-  }
-  else {
-    double _readableVolts = _readableV1 / ((double)R2_B / ((double)R1_B + (double)R2_B));
-    _readableVolts += VoltOffset_B;
-    return (_readableVolts);
-  }
-}
-
-
-//--------------------------------------------------
-// ADC averaged value to Amps
-//--------------------------------------------------
-double make_readable_Amps (double _Value, bool _chan, double _gain) {
-
-  double _readable_2 = (_Value * volts_to_adc_reading_ratio) / _gain; // gives mV signal value.
-
-  if (_chan == 0) {
-    double _readableAmps = _readable_2 / Rshunt_A; // I=V/R
-    _readableAmps += AmpOffset_A; // shunt monitor offset calibration
-    return (_readableAmps);
-  }
-  else {
-    double _readableAmps = _readable_2 / Rshunt_B; // I=V/R
-    _readableAmps += AmpOffset_B; // shunt monitor offset calibration
-    return (_readableAmps);
-  }
-}
-
-
 //-------------------------
 // SD CARD
 //-------------------------
 void save_to_SDcard(void) {
   if (timeConfidence) {
     DateTime now = rtc.now();
-
-    sprintf(datedFilename, "%04d-%02d-%02d.csv", now.year(), now.month(), now.day());
-
-    File dataFile = SD.open(datedFilename, FILE_WRITE);
-    if (dataFile) {
-      dataFile.println(ADC_KeyValue_String);
-      dataFile.close();
-      Serial.print("SD card save OK - dated - ");
-      Serial.println(datedFilename);
-    }
-    else {
-      Serial.println("error opening datedFilename");
-    }
-  }
-
-  else { // if timeConfidence == false.
-    File dataFile = SD.open(datalogFilename, FILE_WRITE);
-    // if the file is available, write to it:
-    if (dataFile) {
-      dataFile.println(ADC_KeyValue_String);
-      dataFile.close();
-      // print to the serial port too:
-      Serial.println("SD card save OK - undated.");
-    }
-    // if the file isn't open, pop up an error:
-    else {
-      Serial.println("error opening datalog.csv");
-    }
+    snprintf(datedFilename, sizeof(datedFilename), "%04d-%02d-%02d.bin", now.year(), now.month(), now.day());
   }
-}
-
-
-//-------------------------
-// Wh accumulator calc.
-//-------------------------
-double Wh_accumulate(double amps_value, double volts_value, int elapsed_seconds) {
-  double watts = amps_value * volts_value;
-  double watt_seconds = watts * (double)elapsed_seconds;
-  double wh = watt_seconds / 3600.0;
-  return wh;
+  sdlog_append(timeConfidence ? datedFilename : datalogFilename.c_str(), last_measurement); // staged, see sdlog.cpp.
 }
 
 
 //-------------------------
 // Battery monitoring.
 //-------------------------
-double time_until_discharged_fromfull(void) { // returns seconds until discharged from ideal battery condition.
-  // http://www.smartgauge.co.uk/peukert2.html
-  // T = (Hr*(C/Hr)^n)/(I^n)
-  double Peukert_capacity = BattCapHr * pow((BattCapacity/BattCapHr), BattPeukert);
-  bool flip = 0;
-  if (Current_B < 0) { flip = true; Current_B = fabs(Current_B); }
-  double _time_until_discharged = Peukert_capacity / (pow(Current_B, BattPeukert));
-  //sprintf(log_buffer, "_time_until_discharged(seconds):%.3f\r\n", _time_until_discharged*3600);
-  //printf("%s",log_buffer);
-  if (flip) { _time_until_discharged = -_time_until_discharged; Current_B = -Current_B; }
-  return _time_until_discharged;
+double time_until_discharged_fromfull(void) { // returns hours until discharged from ideal battery condition.
+  return battery_hours_from_full(battery_params(), Current_B);
 }
 
 double effective_capacity_fromfull(void) { // returns eff. cap. in Ah.
-  // http://www.smartgauge.co.uk/technical1.html
-  // http://www.smartgauge.co.uk/peukert3.html
-  //bool flip = 0;
-  //if (Current_B < 0) { flip = true; Current_B = fabs(Current_B); } // deal with negative readings before pow()
-  double _effective_capacity = time_until_discharged_fromfull() * Current_B;
-  //sprintf(log_buffer, "_effective_capacity(Ah):%.3f\r\n", _effective_capacity);
-  //printf("%s",log_buffer);
-  //if (flip) { _effective_capacity = -_effective_capacity; Current_B = -Current_B; }
-  return _effective_capacity;
+  return battery_effective_capacity(battery_params(), Current_B);
 }
 
-/*
-void reset_ah_capacity(void) {
-  // check the voltage level, check the current flowing into the battery,
-  // if the battery is held at a certain voltage and reads a particular current in or out, 
-  // for a certain length of time, then battery is full.
-  // for example, lead-acid generally, this could be a battery at >14.0V with less than .1A flowing in or out per cell, for 30 minutes.
-  // check battery manufactures instructions and the charger specification and charging modes to know what's expected.
-  // https://batteryuniversity.com/learn/article/charging_the_lead_acid_battery
-  if (Voltage_B >= 14.0 && Current_B <= 0.1) {
-    bool charged_inquiry = true;
-    //uint32_t time1_ah_reset = currentMillis;
-  }
-}
-*/
 /*
 int timer1 = 1000;
 int timer1_previous;
@@ -10,6 +10,7 @@
 
 extern uint16_t main_interval_seconds;
 extern uint32_t main_interval_ms;
+extern uint16_t readings_interval;
 extern unsigned int averaging_loop_counter;
 extern unsigned int _t_begin;
 extern bool chanA_VrefSet; 
@@ -26,12 +27,15 @@ extern double icalA;
 extern double vcalA;
 extern double icalB;
 extern double vcalB;
-extern unsigned int waking_time;
-extern unsigned int sleeping_time;
 extern double AmpOffset_A;
 extern double VoltOffset_A;
 extern double AmpOffset_B;
 extern double VoltOffset_B;
+// last interval averages, counts Q8, reference taken off the currents.
+extern int32_t CH_A_CURRENT_AVERAGED;
+extern int32_t CH_A_VOLTAGE_AVERAGED;
+extern int32_t CH_B_CURRENT_AVERAGED;
+extern int32_t CH_B_VOLTAGE_AVERAGED;
 
 extern uint16_t BattType;
 extern double BattCapacity;
@@ -41,6 +45,7 @@ extern double BattVoltsAlarmHigh;
 extern double BattVoltsAlarmLow;
 extern double BattPeukert;
 extern double BattTempCo;
+extern double state_of_charge; // 1 is full.
 
 // false for chanA, true for chanB.
 const bool chanBool = 0;
@@ -49,8 +54,15 @@ extern int max_screentog;
 extern bool oled_button_flag;
 extern bool OLED_active;
 extern uint32_t oled_interval;
+// pipeline cost, see emondc.cpp.
+extern uint32_t loop_sample_cycles;
+extern uint32_t loop_interval_us;
+extern uint32_t loop_interval_us_max;
+extern float loop_samples_hz;
+extern uint32_t loop_heap_min;
 extern void emondc_setup(void);
 extern void emondc_loop(void);
+void emondc_shutdown(void);
 
 extern String datalogFilename;
 extern bool SD_present;
@@ -58,22 +70,20 @@ extern bool SD_present;
 extern bool timeConfidence;
 
 void config_save_emondc(unsigned int interval, double vcalA, double icalA, double vcalB, double icalB);
-double volts_to_adc_reading_ratio_function(void);
 extern void draw_OLED();
 void NTPupdate_RTCupdate(void);
 void save_to_SDcard(void);
 void print_readable(void);
 void forward_to_emonESP(void);
+void measurement_update(void);
 void average_and_calibrate(unsigned long, unsigned long);
-double Wh_accumulate(double current_value, double voltage_value, int elapsed_seconds);
 double Ah_calculate(double amps_value, int elapsed_seconds);
-double make_readable_Amps(double _adcValue, bool _chan, double _gain);
-double make_readable_Volts(double _adcValue, bool _chan);
 double time_until_discharged_fromfull(void);
 double effective_capacity_fromfull(void);
 double Ah_calculate(double amps_value, uint16_t elapsed_seconds);
-void reset_ah_capacity(void);
 void clear_accumulators(void);
+void accumulate_sample(const uint16_t *readings, uint8_t fresh);
+int32_t average_q8(unsigned long accumulator, uint8_t channel, int32_t previous);
 void set_rtc(const DateTime &dt);
 
 #endif // _EMONDC_H
@@ -39,5 +39,10 @@
 #define DEBUG Serial
 #endif
 
+// Boot timings, ms since reset, 0 until each has happened, see setup().
+extern unsigned long boot_sample_ms;  // first samples drained by emondc_loop().
+extern unsigned long boot_wifi_ms;    // associated with the configured network.
+extern unsigned long boot_post_ms;    // first measurement taken by emoncms or MQTT.
+
 
 #endif // _EMONESP_H
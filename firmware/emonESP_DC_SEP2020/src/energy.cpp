@@ -0,0 +1,102 @@
+// emonDC energy and charge integration, free to use and modify.
+
+// Power is V x I per raw sample pair rather than average V x average I, so the
+// covariance under PWM charge controllers is kept. Sums are 64-bit integers in
+// calibrated micro-units, and are turned into Wh/Ah once per readings interval
+// using the real elapsed time, which also covers samples dropped by the sampler.
+
+#include "energy.h"
+#include "calibration.h"
+#include "emondc.h"
+#include "config.h"
+
+double Wh_chA_positive = 0.0;
+double Wh_chB_positive = 0.0;
+double Wh_chA_negative = 0.0;
+double Wh_chB_negative = 0.0;
+double Ah_positive_A = 0.0;
+double Ah_positive_B = 0.0;
+double Ah_negative_A = 0.0;
+double Ah_negative_B = 0.0;
+double Ah_period_B = 0.0;
+
+#define ENERGY_POWER_SHIFT 20 // uV x uA products are summed >> 20, about 1uW resolution.
+
+struct energy_sums_t {
+  int64_t power_pos;  // (uV x uA) >> ENERGY_POWER_SHIFT, summed over samples.
+  int64_t power_neg;
+  int64_t charge_pos; // uA, summed over samples.
+  int64_t charge_neg;
+};
+
+static energy_sums_t energy_sums[2];
+static uint32_t energy_samples = 0;
+static unsigned long energy_savedMillis = 0;
+static bool energy_unsaved = false;
+
+static void energy_accumulate_channel(energy_sums_t &sums, int32_t current_counts, uint16_t voltage_counts,
+                                      uint8_t cal_current, uint8_t cal_voltage) {
+  int32_t uA = calibration_apply(cal_current, current_counts * 256);
+  int32_t uV = calibration_apply(cal_voltage, (int32_t)voltage_counts << 8);
+  int64_t power = (int64_t)uV * uA;
+
+  if (power >= 0) sums.power_pos += power >> ENERGY_POWER_SHIFT;
+  else sums.power_neg += (-power) >> ENERGY_POWER_SHIFT;
+  if (uA >= 0) sums.charge_pos += uA;
+  else sums.charge_neg -= uA;
+}
+
+void energy_accumulate(const uint16_t *readings) {
+  // readings[4] is the bidirectional reference, readings[5] the unidirectional.
+  int32_t ref_A = chanA_VrefSet ? readings[4] : readings[5];
+  int32_t ref_B = chanB_VrefSet ? readings[4] : readings[5];
+
+  energy_accumulate_channel(energy_sums[0], (int32_t)readings[0] - ref_A, readings[1], CAL_CURRENT_A, CAL_VOLTAGE_A);
+  energy_accumulate_channel(energy_sums[1], (int32_t)readings[2] - ref_B, readings[3], CAL_CURRENT_B, CAL_VOLTAGE_B);
+  energy_samples++;
+}
+
+void energy_update(unsigned long elapsed_ms) {
+  Ah_period_B = 0.0;
+  if (energy_samples == 0) return;
+
+  double hours_per_sample = (elapsed_ms / 3600000.0) / energy_samples;
+  double Wh_per_unit = hours_per_sample * (double)(1UL << ENERGY_POWER_SHIFT) * 1e-12;
+  double Ah_per_unit = hours_per_sample * 1e-6;
+
+  Wh_chA_positive += energy_sums[0].power_pos * Wh_per_unit;
+  Wh_chA_negative += energy_sums[0].power_neg * Wh_per_unit;
+  Ah_positive_A += energy_sums[0].charge_pos * Ah_per_unit;
+  Ah_negative_A += energy_sums[0].charge_neg * Ah_per_unit;
+
+  Wh_chB_positive += energy_sums[1].power_pos * Wh_per_unit;
+  Wh_chB_negative += energy_sums[1].power_neg * Wh_per_unit;
+  Ah_positive_B += energy_sums[1].charge_pos * Ah_per_unit;
+  Ah_negative_B += energy_sums[1].charge_neg * Ah_per_unit;
+  Ah_period_B = (energy_sums[1].charge_pos - energy_sums[1].charge_neg) * Ah_per_unit;
+
+  memset(energy_sums, 0, sizeof(energy_sums));
+  energy_samples = 0;
+  energy_unsaved = true;
+
+  if (millis() - energy_savedMillis >= ENERGY_SAVE_INTERVAL_MS) energy_save();
+}
+
+void energy_save(void) {
+  energy_savedMillis = millis();
+  if (!energy_unsaved) return;
+  checkpoint_save();
+  energy_unsaved = false;
+}
+
+void energy_reset(void) {
+  Wh_chA_positive = 0.0;
+  Wh_chB_positive = 0.0;
+  Wh_chA_negative = 0.0;
+  Wh_chB_negative = 0.0;
+  Ah_positive_A = 0.0;
+  Ah_positive_B = 0.0;
+  Ah_negative_A = 0.0;
+  Ah_negative_B = 0.0;
+  energy_unsaved = false;
+}
@@ -0,0 +1,34 @@
+// emonDC energy and charge integration, free to use and modify.
+
+#ifndef _EMONDC_ENERGY_H
+#define _EMONDC_ENERGY_H
+
+#include <Arduino.h>
+#include "checkpoint.h"
+
+// the totals and the state of charge go to the checkpoint ring this often.
+#define ENERGY_SAVE_INTERVAL_MS CHECKPOINT_INTERVAL_MS
+
+// Running totals, "positive" is current flowing into the channel (charging).
+extern double Wh_chA_positive;
+extern double Wh_chB_positive;
+extern double Wh_chA_negative;
+extern double Wh_chB_negative;
+extern double Ah_positive_A;
+extern double Ah_positive_B;
+extern double Ah_negative_A;
+extern double Ah_negative_B;
+
+// net channel B charge over the last energy_update() period, for the state of charge.
+extern double Ah_period_B;
+
+// V x I and I for one raw sample set, call for every sample taken.
+void energy_accumulate(const uint16_t *readings);
+// Fold the sample sums into the totals, elapsed_ms is the real time they cover.
+void energy_update(unsigned long elapsed_ms);
+// Save the totals to flash now, see checkpoint.h.
+void energy_save(void);
+// Zero the totals, with the factory reset.
+void energy_reset(void);
+
+#endif // _EMONDC_ENERGY_H
@@ -0,0 +1,133 @@
+// emonDC raw sample filters, free to use and modify.
+
+// All integer. After the median the value is carried in Q8 counts through the
+// IIR and the notch, and turned back into whole counts with the rounding error
+// carried to the next sample, so the interval averages keep the fraction the
+// filters worked out rather than being biased by up to half a count.
+// The notch is a biquad with its zeros on the unit circle and poles at radius
+// FILTER_NOTCH_RADIUS, normalised to unity gain at DC. A PWM frequency above
+// half the sample rate is folded to where it aliases. A notch close to DC
+// would take the signal out with it, so one that folds there is left off.
+
+#include "filter.h"
+#include "sampler.h"
+#include "debug.h"
+
+#define FILTER_COEFF_SHIFT   14     // notch coefficients in Q14.
+#define FILTER_NOTCH_RADIUS  0.95
+#define FILTER_NOTCH_MIN_HZ  (sample_rate_hz / 50.0)
+
+uint8_t filter_flags[FILTER_CHANNELS] = {0, 0, 0, 0};
+uint8_t filter_iir_shift = FILTER_IIR_SHIFT_DEFAULT;
+uint16_t filter_notch_hz = 0;
+uint32_t filter_cycles = 0;
+uint32_t filter_cycles_max = 0;
+
+struct filter_channel_t {
+  uint16_t median[2];    // previous two readings.
+  bool primed;
+  int32_t iir_q8;
+  int32_t x1_q8, x2_q8;  // notch input and output history.
+  int32_t y1_q8, y2_q8;
+  int32_t residual_q8;   // rounding carried to the next sample.
+};
+
+static filter_channel_t filter_channels[FILTER_CHANNELS];
+static bool filter_notch_on = false;
+static int32_t filter_b0, filter_b1, filter_a1, filter_a2; // b2 == b0.
+static uint64_t filter_cycles_sum = 0;
+static uint32_t filter_passes = 0;
+static uint32_t filter_cycles_peak = 0;
+
+
+void filter_configure(void) {
+  if (filter_iir_shift < 1 || filter_iir_shift > FILTER_IIR_SHIFT_MAX) filter_iir_shift = FILTER_IIR_SHIFT_DEFAULT;
+  memset(filter_channels, 0, sizeof(filter_channels));
+
+  filter_notch_on = false;
+  if (filter_notch_hz > 0 && sample_rate_hz > 0) {
+    double f = fmod((double)filter_notch_hz, (double)sample_rate_hz);
+    if (f > sample_rate_hz / 2.0) f = sample_rate_hz - f; // where it aliases to.
+    if (f >= FILTER_NOTCH_MIN_HZ) {
+      double c = cos(2 * PI * f / sample_rate_hz);
+      double r = FILTER_NOTCH_RADIUS;
+      double g = (1 - 2 * r * c + r * r) / (2 - 2 * c); // unity gain at DC.
+      double one = 1 << FILTER_COEFF_SHIFT;
+      filter_b0 = lround(g * one);
+      filter_b1 = lround(-2 * g * c * one);
+      filter_a1 = lround(-2 * r * c * one);
+      filter_a2 = lround(r * r * one);
+      filter_notch_on = true;
+    }
+    DBUGF("filter: notch %u Hz aliases to %.1f Hz, %s", filter_notch_hz, f, filter_notch_on ? "on" : "too close to DC, off");
+  }
+}
+
+static inline uint16_t filter_median3(uint16_t a, uint16_t b, uint16_t c) {
+  if (a > b) { uint16_t t = a; a = b; b = t; }
+  if (b > c) b = c;
+  return a > b ? a : b;
+}
+
+void filter_apply(uint16_t *readings, uint8_t fresh) {
+  uint32_t start = ESP.getCycleCount();
+  for (uint8_t ch = 0; ch < FILTER_CHANNELS; ch++) {
+    uint8_t flags = filter_flags[ch];
+    if (!flags || !(fresh & (1 << ch))) continue;
+    filter_channel_t &f = filter_channels[ch];
+    uint16_t x = readings[ch];
+
+    if (!f.primed) {
+      // start every stage from the first reading rather than from 0.
+      f.median[0] = f.median[1] = x;
+      f.iir_q8 = f.x1_q8 = f.x2_q8 = f.y1_q8 = f.y2_q8 = (int32_t)x << 8;
+      f.primed = true;
+    }
+
+    if (flags & FILTER_MEDIAN) {
+      uint16_t m = filter_median3(x, f.median[0], f.median[1]);
+      f.median[1] = f.median[0];
+      f.median[0] = x;
+      x = m;
+    }
+    if (!(flags & (FILTER_IIR | FILTER_NOTCH))) {
+      readings[ch] = x;
+      continue;
+    }
+
+    int32_t v_q8 = (int32_t)x << 8;
+    if (flags & FILTER_IIR) {
+      f.iir_q8 += (v_q8 - f.iir_q8) >> filter_iir_shift;
+      v_q8 = f.iir_q8;
+    }
+    if ((flags & FILTER_NOTCH) && filter_notch_on) {
+      int64_t acc = (int64_t)filter_b0 * (v_q8 + f.x2_q8) + (int64_t)filter_b1 * f.x1_q8
+                    - (int64_t)filter_a1 * f.y1_q8 - (int64_t)filter_a2 * f.y2_q8;
+      int32_t y_q8 = (int32_t)(acc >> FILTER_COEFF_SHIFT);
+      f.x2_q8 = f.x1_q8;
+      f.x1_q8 = v_q8;
+      f.y2_q8 = f.y1_q8;
+      f.y1_q8 = y_q8;
+      v_q8 = y_q8;
+    }
+
+    int32_t out_q8 = v_q8 + f.residual_q8;
+    int32_t out = out_q8 >> 8;
+    f.residual_q8 = out_q8 - (out << 8);
+    if (out < 0) out = 0;
+    if (out > 4095) out = 4095;
+    readings[ch] = out;
+  }
+  uint32_t cycles = ESP.getCycleCount() - start;
+  filter_cycles_sum += cycles;
+  filter_passes++;
+  if (cycles > filter_cycles_peak) filter_cycles_peak = cycles;
+}
+
+void filter_finish(void) {
+  filter_cycles = filter_passes ? filter_cycles_sum / filter_passes : 0;
+  filter_cycles_max = filter_cycles_peak;
+  filter_cycles_sum = 0;
+  filter_passes = 0;
+  filter_cycles_peak = 0;
+}
@@ -0,0 +1,39 @@
+// emonDC raw sample filters, free to use and modify.
+
+#ifndef _EMONDC_FILTER_H
+#define _EMONDC_FILTER_H
+
+#include <Arduino.h>
+
+// A chain of filters on channels 0-3 (A current, A voltage, B current,
+// B voltage), run on each new reading before it is accumulated, so the
+// averages and max/min see the filtered values. The energy does not: a notch
+// or low pass on both V and I would take out the V x I ripple the per sample
+// integration is there to count. The capture and stream keep the raw samples
+// too.
+#define FILTER_CHANNELS 4
+
+// filter_flags bits, applied in this order.
+#define FILTER_MEDIAN 0x01 // median of the last 3 readings, drops single sample spikes.
+#define FILTER_IIR    0x02 // single pole low pass, y += (x - y) / 2^filter_iir_shift.
+#define FILTER_NOTCH  0x04 // notch at filter_notch_hz, as it aliases at the sample rate.
+
+#define FILTER_IIR_SHIFT_DEFAULT 2
+#define FILTER_IIR_SHIFT_MAX     8
+
+extern uint8_t filter_flags[FILTER_CHANNELS];
+extern uint8_t filter_iir_shift;
+extern uint16_t filter_notch_hz;  // PWM frequency of the charge controller, 0 for none.
+
+// Cost of the chain per sample set, in CPU cycles (cpu_mhz on /status per us), over the last interval.
+extern uint32_t filter_cycles;
+extern uint32_t filter_cycles_max;
+
+// Apply the settings, after they or the sample rate change. Restarts the filters.
+void filter_configure(void);
+// Filter the channels read on this pass (fresh), in place.
+void filter_apply(uint16_t *readings, uint8_t fresh);
+// Work out the cost for the interval and start the next.
+void filter_finish(void);
+
+#endif // _EMONDC_FILTER_H
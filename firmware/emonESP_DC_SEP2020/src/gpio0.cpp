@@ -67,6 +67,7 @@ void gpio0_loop()
     led_flash(800, 800);
     Serial.println("Commencing factory reset.");
     delay(500);
+    emondc_shutdown(); // SD log flushed before the settings go.
     config_reset();
     Serial.println("Factory reset complete! Resetting...");
     led_flash(800, 800);
@@ -0,0 +1,130 @@
+// emonDC HTTP reply parser, free to use and modify.
+
+// A byte at a time through the status line and headers, which only look at
+// the start of each line, and in runs through the body, of which only the
+// start is kept. Used from the AsyncClient's onData, so the reply can arrive
+// in any number of pieces split anywhere.
+
+#include "http_reply.h"
+
+enum {
+  HTTP_REPLY_STATUS,
+  HTTP_REPLY_HEADERS,
+  HTTP_REPLY_BODY,
+  HTTP_REPLY_CHUNK_SIZE,
+  HTTP_REPLY_CHUNK_DATA,
+  HTTP_REPLY_CHUNK_END,   // the CRLF after a chunk's data.
+  HTTP_REPLY_TRAILER,
+  HTTP_REPLY_DONE,
+};
+
+void http_reply_begin(http_reply_t &reply) {
+  reply.state = HTTP_REPLY_STATUS;
+  reply.status = 0;
+  reply.keep_alive = false;
+  reply.chunked = false;
+  reply.remaining = -1;
+  reply.line_len = 0;
+  reply.body[0] = 0;
+  reply.body_len = 0;
+}
+
+bool http_reply_done(const http_reply_t &reply) {
+  return reply.state == HTTP_REPLY_DONE;
+}
+
+// The value of a header line if it is the one named, NULL if not.
+static const char *http_reply_header(const char *line, const char *name) {
+  size_t len = strlen(name);
+  if (strncasecmp(line, name, len) != 0 || line[len] != ':') return NULL;
+  line += len + 1;
+  while (*line == ' ' || *line == '\t') line++;
+  return line;
+}
+
+static void http_reply_end_headers(http_reply_t &reply) {
+  if (reply.status >= 100 && reply.status < 200) { // an interim reply, the real one follows.
+    reply.state = HTTP_REPLY_STATUS;
+    reply.chunked = false;
+    reply.remaining = -1;
+  }
+  else if (reply.status == 204 || reply.status == 304) reply.state = HTTP_REPLY_DONE;
+  else if (reply.chunked) reply.state = HTTP_REPLY_CHUNK_SIZE;
+  else if (reply.remaining == 0) reply.state = HTTP_REPLY_DONE;
+  else {
+    if (reply.remaining < 0) reply.keep_alive = false; // the body runs to the close.
+    reply.state = HTTP_REPLY_BODY;
+  }
+}
+
+static void http_reply_take_line(http_reply_t &reply) {
+  const char *line = reply.line;
+  const char *value;
+  switch (reply.state) {
+  case HTTP_REPLY_STATUS:
+    if (reply.line_len == 0) break; // a stray CRLF before it.
+    if (strncmp(line, "HTTP/1.", 7) != 0 || reply.line_len < 12) {
+      reply.state = HTTP_REPLY_DONE; // not HTTP, status stays 0.
+      break;
+    }
+    reply.keep_alive = line[7] == '1'; // HTTP/1.1 keeps the connection unless it says not to.
+    reply.status = atoi(line + 9);
+    reply.state = HTTP_REPLY_HEADERS;
+    break;
+  case HTTP_REPLY_HEADERS:
+    if (reply.line_len == 0) http_reply_end_headers(reply);
+    else if ((value = http_reply_header(line, "Content-Length"))) reply.remaining = atol(value);
+    else if ((value = http_reply_header(line, "Transfer-Encoding"))) reply.chunked = strncasecmp(value, "chunked", 7) == 0;
+    else if ((value = http_reply_header(line, "Connection"))) {
+      if (strncasecmp(value, "close", 5) == 0) reply.keep_alive = false;
+      else if (strncasecmp(value, "keep-alive", 10) == 0) reply.keep_alive = true;
+    }
+    break;
+  case HTTP_REPLY_CHUNK_SIZE:
+    reply.remaining = strtol(line, NULL, 16);
+    reply.state = reply.remaining > 0 ? HTTP_REPLY_CHUNK_DATA : HTTP_REPLY_TRAILER;
+    break;
+  case HTTP_REPLY_CHUNK_END:
+    reply.state = HTTP_REPLY_CHUNK_SIZE;
+    break;
+  case HTTP_REPLY_TRAILER:
+    if (reply.line_len == 0) reply.state = HTTP_REPLY_DONE;
+    break;
+  }
+  reply.line_len = 0;
+}
+
+bool http_reply_feed(http_reply_t &reply, const char *data, size_t len) {
+  size_t i = 0;
+  while (i < len && reply.state != HTTP_REPLY_DONE) {
+    if (reply.state == HTTP_REPLY_BODY || reply.state == HTTP_REPLY_CHUNK_DATA) {
+      size_t run = len - i;
+      if (reply.remaining >= 0 && run > (size_t)reply.remaining) run = reply.remaining;
+      size_t keep = min(run, (size_t)(HTTP_REPLY_BODY_SIZE - 1 - reply.body_len));
+      memcpy(reply.body + reply.body_len, data + i, keep);
+      reply.body_len += keep;
+      reply.body[reply.body_len] = 0;
+      i += run;
+      if (reply.remaining < 0) continue;
+      reply.remaining -= run;
+      if (reply.remaining == 0) reply.state = reply.chunked ? HTTP_REPLY_CHUNK_END : HTTP_REPLY_DONE;
+      continue;
+    }
+
+    char c = data[i++];
+    if (c == '\n') {
+      reply.line[reply.line_len] = 0;
+      http_reply_take_line(reply);
+    }
+    else if (c != '\r' && reply.line_len < HTTP_REPLY_LINE_SIZE - 1) {
+      reply.line[reply.line_len++] = c;
+    }
+  }
+  return reply.state == HTTP_REPLY_DONE;
+}
+
+bool http_reply_close(http_reply_t &reply) {
+  if (reply.state == HTTP_REPLY_BODY && reply.remaining < 0) reply.state = HTTP_REPLY_DONE;
+  reply.keep_alive = false;
+  return reply.state == HTTP_REPLY_DONE;
+}
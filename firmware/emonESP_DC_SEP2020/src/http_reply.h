@@ -0,0 +1,37 @@
+// emonDC HTTP reply parser, free to use and modify.
+
+#ifndef _EMONDC_HTTP_REPLY_H
+#define _EMONDC_HTTP_REPLY_H
+
+#include <Arduino.h>
+
+// An HTTP/1.1 reply, taken a piece at a time as it arrives, with only what
+// a post needs kept: the status code, whether the server keeps the connection
+// and the start of the body. The status line and headers are read a line at a
+// time and not kept, so any amount of them is fine; of each line only the
+// first HTTP_REPLY_LINE_SIZE - 1 characters are looked at. The body ends by
+// Content-Length, by the last chunk of a chunked one, or by the server closing
+// the connection when it gives neither.
+#define HTTP_REPLY_LINE_SIZE 48
+#define HTTP_REPLY_BODY_SIZE 64
+
+struct http_reply_t {
+  uint8_t state;
+  uint16_t status;     // 0 until the status line is in.
+  bool keep_alive;     // the connection can take another request after this reply.
+  bool chunked;
+  int32_t remaining;   // body bytes to come, or of the chunk; -1 up to the close.
+  char line[HTTP_REPLY_LINE_SIZE];
+  uint8_t line_len;
+  char body[HTTP_REPLY_BODY_SIZE]; // start of the body, null terminated.
+  uint8_t body_len;
+};
+
+void http_reply_begin(http_reply_t &reply);
+// Take the next len bytes, true once the reply is complete. Bytes after it are ignored.
+bool http_reply_feed(http_reply_t &reply, const char *data, size_t len);
+// The server closed the connection: true if that completed the reply, false if it was cut short.
+bool http_reply_close(http_reply_t &reply);
+bool http_reply_done(const http_reply_t &reply);
+
+#endif // _EMONDC_HTTP_REPLY_H
@@ -0,0 +1,78 @@
+// emonDC measurement record, free to use and modify.
+
+// The measurement is a plain struct of scaled integers. emoncms, MQTT, the SD
+// log, /lastvalues and the OLED all read from it, rather than each one parsing
+// a shared key:value String.
+
+#include "measurement.h"
+
+static const struct {
+  const char *name;
+  int8_t exponent;
+} measurement_fields[MEAS_FIELDS] = {
+  {"Volts_A", -3}, {"Volts_A_Max", -3}, {"Volts_A_Min", -3},
+  {"Amps_A", -3}, {"Amps_A_Max", -3}, {"Amps_A_Min", -3},
+  {"Volts_B", -3}, {"Volts_B_Max", -3}, {"Volts_B_Min", -3},
+  {"Amps_B", -3}, {"Amps_B_Max", -3}, {"Amps_B_Min", -3},
+  {"Ref_Uni", -4}, {"Ref_Bi", -4}, {"CH8", -2},
+  {"SoC(%)", -2}, {"TimeUD(h)", -2},
+  {"Wh_in_A", -3}, {"Wh_out_A", -3}, {"Ah_in_A", -3}, {"Ah_out_A", -3},
+  {"Wh_in_B", -3}, {"Wh_out_B", -3}, {"Ah_in_B", -3}, {"Ah_out_B", -3},
+  {"samplecount", 0},
+};
+
+Measurement last_measurement;
+char measurement_text[MEASUREMENT_TEXT_SIZE] = "";
+bool measurement_pending = false;
+
+const char *measurement_name(meas_field_t field) {
+  return measurement_fields[field].name;
+}
+
+int8_t measurement_exponent(meas_field_t field) {
+  return measurement_fields[field].exponent;
+}
+
+int32_t measurement_fixed(meas_field_t field, double value) {
+  double scaled = value;
+  for (int8_t e = measurement_fields[field].exponent; e < 0; e++) scaled *= 10.0;
+  if (scaled > 2147483647.0) return INT32_MAX;
+  if (scaled < -2147483648.0) return INT32_MIN;
+  return lround(scaled);
+}
+
+double measurement_value(const Measurement &m, meas_field_t field) {
+  double value = m.value[field];
+  for (int8_t e = measurement_fields[field].exponent; e < 0; e++) value *= 0.1;
+  return value;
+}
+
+uint16_t measurement_format_fixed(char *out, int32_t value, int8_t exponent) {
+  if (exponent >= 0) {
+    uint16_t len = sprintf(out, "%ld", (long)value);
+    if (value != 0) for (int8_t e = 0; e < exponent; e++) out[len++] = '0';
+    out[len] = 0;
+    return len;
+  }
+  uint32_t divisor = 1;
+  for (int8_t e = exponent; e < 0; e++) divisor *= 10;
+  uint32_t magnitude = (value < 0) ? (uint32_t)(-(int64_t)value) : (uint32_t)value;
+  return sprintf(out, "%s%lu.%0*lu", (value < 0) ? "-" : "", (unsigned long)(magnitude / divisor),
+                 (int)-exponent, (unsigned long)(magnitude % divisor));
+}
+
+size_t measurement_format(const Measurement &m, char *buffer, size_t size) {
+  // longest field is an 11 character name, ':', a sign, 10 digits, a point and ','.
+  if (size < MEASUREMENT_TEXT_SIZE) {
+    if (size > 0) buffer[0] = 0;
+    return 0;
+  }
+  size_t len = 0;
+  for (uint8_t i = 0; i < MEAS_FIELDS; i++) {
+    len += sprintf(buffer + len, "%s:", measurement_fields[i].name);
+    len += measurement_format_fixed(buffer + len, m.value[i], measurement_fields[i].exponent);
+    buffer[len++] = ',';
+  }
+  len += sprintf(buffer + len, "%s:%lu", m.rtc_time ? "rtcTime" : "runTime", (unsigned long)m.time);
+  return len;
+}
@@ -0,0 +1,50 @@
+// emonDC measurement record, free to use and modify.
+
+#ifndef _EMONDC_MEASUREMENT_H
+#define _EMONDC_MEASUREMENT_H
+
+#include <Arduino.h>
+
+// Published fields, values are int32 scaled by 10^exponent (see measurement.cpp).
+enum meas_field_t {
+  MEAS_VOLTS_A, MEAS_VOLTS_A_MAX, MEAS_VOLTS_A_MIN,
+  MEAS_AMPS_A, MEAS_AMPS_A_MAX, MEAS_AMPS_A_MIN,
+  MEAS_VOLTS_B, MEAS_VOLTS_B_MAX, MEAS_VOLTS_B_MIN,
+  MEAS_AMPS_B, MEAS_AMPS_B_MAX, MEAS_AMPS_B_MIN,
+  MEAS_REF_UNI, MEAS_REF_BI, MEAS_CH8,
+  MEAS_SOC, MEAS_TIMEUD,
+  MEAS_WH_IN_A, MEAS_WH_OUT_A, MEAS_AH_IN_A, MEAS_AH_OUT_A,
+  MEAS_WH_IN_B, MEAS_WH_OUT_B, MEAS_AH_IN_B, MEAS_AH_OUT_B,
+  MEAS_SAMPLECOUNT,
+  MEAS_FIELDS
+};
+
+// One set of readable values, filled once per readings interval.
+struct Measurement {
+  uint32_t time;     // unix time when rtc_time, seconds since sampling began otherwise.
+  bool rtc_time;
+  int32_t value[MEAS_FIELDS];
+};
+
+// key:value,... text of a measurement, sized for every field at full width.
+#define MEASUREMENT_TEXT_SIZE 704
+
+extern Measurement last_measurement;
+// text of the last posted measurement, and whether the network sinks have had it yet.
+extern char measurement_text[MEASUREMENT_TEXT_SIZE];
+extern bool measurement_pending;
+
+const char *measurement_name(meas_field_t field);
+int8_t measurement_exponent(meas_field_t field);
+
+// Scale a reading for the field's exponent, and back.
+int32_t measurement_fixed(meas_field_t field, double value);
+double measurement_value(const Measurement &m, meas_field_t field);
+
+// Decimal text of a scaled value, returns the length written.
+uint16_t measurement_format_fixed(char *out, int32_t value, int8_t exponent);
+
+// key:value,...,rtcTime:t text as posted to emoncms, into a caller buffer.
+size_t measurement_format(const Measurement &m, char *buffer, size_t size);
+
+#endif // _EMONDC_MEASUREMENT_H
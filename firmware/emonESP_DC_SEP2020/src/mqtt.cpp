@@ -26,6 +26,7 @@
 #include "emonesp.h"
 #include "mqtt.h"
 #include "config.h"
+#include "measurement.h"
 
 #include <Arduino.h>
 #include <PubSubClient.h>             // MQTT https://github.com/knolleary/pubsubclient PlatformIO lib: 89
@@ -65,43 +66,135 @@ boolean mqtt_connect()
 // base topic = emon/emonesp
 // MQTT Publish: emon/emonesp/CT1 > 3935 etc..
 // -------------------------------------------------------------------
-void mqtt_publish(String data)
+#define MQTT_TOPIC_SIZE 96
+#define MQTT_VALUE_SIZE 24
+#define MQTT_JSON_SIZE  (MEASUREMENT_TEXT_SIZE + 128)
+
+// Topics are built once per config change, into one allocation:
+// <base_topic>/<prefix><field> for each measurement field, then the extras.
+enum { MQTT_TOPIC_RTCTIME = MEAS_FIELDS, MQTT_TOPIC_RUNTIME, MQTT_TOPIC_FREERAM, MQTT_TOPIC_JSON, MQTT_TOPICS };
+static char *mqtt_topic_pool = NULL;
+static const char *mqtt_topics[MQTT_TOPICS];
+static char mqtt_base_topic[MQTT_TOPIC_SIZE]; // <base_topic>/<prefix>, for free-form input.
+static size_t mqtt_base_len = 0;
+static char mqtt_value[MQTT_VALUE_SIZE];
+static char mqtt_json[MQTT_JSON_SIZE];
+
+void mqtt_topics_update()
 {
-  String mqtt_data = "";
-  String topic = mqtt_topic + "/" + mqtt_feed_prefix;
-  int i=0;
-  while (int (data[i]) != 0)
+  int len = snprintf(mqtt_base_topic, MQTT_TOPIC_SIZE, "%s/%s", mqtt_topic.c_str(), mqtt_feed_prefix.c_str());
+  mqtt_base_len = min(len, MQTT_TOPIC_SIZE - 1); // settings are shorter than this, but truncated to be safe.
+
+  const char *names[MQTT_TOPICS];
+  for (uint8_t i = 0; i < MEAS_FIELDS; i++) names[i] = measurement_name((meas_field_t)i);
+  names[MQTT_TOPIC_RTCTIME] = "rtcTime";
+  names[MQTT_TOPIC_RUNTIME] = "runTime";
+  names[MQTT_TOPIC_FREERAM] = "freeram";
+  names[MQTT_TOPIC_JSON] = "json";
+
+  size_t pool_size = mqtt_topic.length() + 6; // <base_topic>/json, not prefixed.
+  for (uint8_t i = 0; i < MQTT_TOPIC_JSON; i++) pool_size += mqtt_base_len + strlen(names[i]) + 1;
+
+  free(mqtt_topic_pool);
+  mqtt_topic_pool = (char *)malloc(pool_size);
+  if (!mqtt_topic_pool) {
+    for (uint8_t i = 0; i < MQTT_TOPICS; i++) mqtt_topics[i] = NULL;
+    return;
+  }
+  char *p = mqtt_topic_pool;
+  for (uint8_t i = 0; i < MQTT_TOPIC_JSON; i++) {
+    mqtt_topics[i] = p;
+    memcpy(p, mqtt_base_topic, mqtt_base_len);
+    strcpy(p + mqtt_base_len, names[i]);
+    p += mqtt_base_len + strlen(names[i]) + 1;
+  }
+  mqtt_topics[MQTT_TOPIC_JSON] = p;
+  sprintf(p, "%s/json", mqtt_topic.c_str());
+}
+
+static void mqtt_publish_cached(uint8_t topic, const char *value)
+{
+  if (mqtt_topics[topic]) mqttclient.publish(mqtt_topics[topic], value);
+}
+
+static void mqtt_publish_freeram()
+{
+  snprintf(mqtt_value, sizeof(mqtt_value), "%lu", (unsigned long)ESP.getFreeHeap());
+  mqtt_publish_cached(MQTT_TOPIC_FREERAM, mqtt_value);
+}
+
+void mqtt_publish(const char *data)
+{
+  char topic[MQTT_TOPIC_SIZE];
+  memcpy(topic, mqtt_base_topic, mqtt_base_len);
+  const char *p = data;
+  while (*p)
   {
     // Construct MQTT topic e.g. <base_topic>/CT1 e.g. emonesp/CT1
-    while (data[i]!=':'){
-      topic+= data[i];
-      i++;
-      if (int(data[i])==0){
-        break;
-      }
+    size_t t = mqtt_base_len;
+    while (*p && *p != ':') {
+      if (t < MQTT_TOPIC_SIZE - 1) topic[t++] = *p;
+      p++;
     }
-    i++;
+    topic[t] = 0;
+    if (*p) p++;
     // Construct data string to publish to above topic
-    while (data[i]!=','){
-      mqtt_data+= data[i];
-      i++;
-      if (int(data[i])==0){
-        break;
-      }
+    size_t v = 0;
+    while (*p && *p != ',') {
+      if (v < MQTT_VALUE_SIZE - 1) mqtt_value[v++] = *p;
+      p++;
     }
+    mqtt_value[v] = 0;
+    if (*p) p++;
     // send data via mqtt
-    //delay(100);
-    DEBUG.printf("%s = %s\r\n", topic.c_str(), mqtt_data.c_str());
-    mqttclient.publish(topic.c_str(), mqtt_data.c_str());
-    topic = mqtt_topic + "/" + mqtt_feed_prefix;
-    mqtt_data="";
-    i++;
-    if (int(data[i]) == 0) break;
+    DEBUG.printf("%s = %s\r\n", topic, mqtt_value);
+    mqttclient.publish(topic, mqtt_value);
+  }
+
+  mqtt_publish_freeram();
+}
+
+// -------------------------------------------------------------------
+// Publish a measurement as one JSON message to <base_topic>/json
+// -------------------------------------------------------------------
+static void mqtt_publish_json(const Measurement &m)
+{
+  size_t len = 0;
+  mqtt_json[len++] = '{';
+  for (uint8_t i = 0; i < MEAS_FIELDS; i++) {
+    len += sprintf(mqtt_json + len, "\"%s\":", measurement_name((meas_field_t)i));
+    len += measurement_format_fixed(mqtt_json + len, m.value[i], measurement_exponent((meas_field_t)i));
+    mqtt_json[len++] = ',';
+  }
+  len += sprintf(mqtt_json + len, "\"%s\":%lu,\"freeram\":%lu}", m.rtc_time ? "rtcTime" : "runTime",
+                 (unsigned long)m.time, (unsigned long)ESP.getFreeHeap());
+
+  // streamed, so the message does not have to fit the PubSubClient buffer.
+  if (!mqtt_topics[MQTT_TOPIC_JSON]) return;
+  if (mqttclient.beginPublish(mqtt_topics[MQTT_TOPIC_JSON], len, false)) {
+    mqttclient.write((const uint8_t *)mqtt_json, len);
+    mqttclient.endPublish();
+  }
+}
+
+// -------------------------------------------------------------------
+// Publish a measurement to MQTT, one sub topic per field or as JSON
+// -------------------------------------------------------------------
+void mqtt_publish_measurement(const Measurement &m)
+{
+  if (boot_post_ms == 0 && mqttclient.connected()) boot_post_ms = millis();
+  if (mqtt_json_mode) {
+    mqtt_publish_json(m);
+    return;
+  }
+  for (uint8_t i = 0; i < MEAS_FIELDS; i++) {
+    measurement_format_fixed(mqtt_value, m.value[i], measurement_exponent((meas_field_t)i));
+    mqtt_publish_cached(i, mqtt_value);
   }
+  snprintf(mqtt_value, sizeof(mqtt_value), "%lu", (unsigned long)m.time);
+  mqtt_publish_cached(m.rtc_time ? MQTT_TOPIC_RTCTIME : MQTT_TOPIC_RUNTIME, mqtt_value);
 
-  String ram_topic = mqtt_topic + "/" + mqtt_feed_prefix + "freeram";
-  String free_ram = String(ESP.getFreeHeap());
-  mqttclient.publish(ram_topic.c_str(), free_ram.c_str());
+  mqtt_publish_freeram();
 }
 
 // -------------------------------------------------------------------
@@ -43,7 +43,20 @@ extern void mqtt_loop();
 //
 // data: a comma seperated list of name:value pairs to send
 // -------------------------------------------------------------------
-extern void mqtt_publish(String data);
+extern void mqtt_publish(const char *data);
+
+// -------------------------------------------------------------------
+// Publish a measurement to MQTT, straight from the record. One sub topic
+// per field, or a single JSON message to <base_topic>/json when
+// mqtt_json_mode is set.
+// -------------------------------------------------------------------
+struct Measurement;
+extern void mqtt_publish_measurement(const Measurement &m);
+
+// -------------------------------------------------------------------
+// Rebuild the cached topic strings, after the MQTT config changes
+// -------------------------------------------------------------------
+extern void mqtt_topics_update();
 
 // -------------------------------------------------------------------
 // Restart the MQTT connection
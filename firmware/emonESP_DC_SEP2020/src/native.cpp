@@ -0,0 +1,120 @@
+// emonDC host build, free to use and modify.
+
+// pio run -e native builds the sampling pipeline for the host against
+// lib/native_hal: the timer ISR, readBurst() on the emulated HSPI and MCP3208,
+// the filters, calibration, energy, battery, the SD log and replay staging.
+// The network, web server, OLED button, EEPROM config and flash checkpoints
+// stay on the board; their few globals are stood in for below, with the
+// defaults a fresh board boots with.
+// The bench runs emondc_loop() on the simulated clock and reports what /status
+// reports on the board, in host time with the SPI bus time added to the ISR's,
+// plus the heap allocations per post:
+//   .pio/build/native/program [seconds] [sd dir]
+
+#ifdef EMONDC_NATIVE
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "emonesp.h"
+#include "config.h"
+#include "wifi.h"
+#include "gpio0.h"
+#include "stream.h"
+#include "checkpoint.h"
+#include "emondc.h"
+#include "sampler.h"
+#include "sdlog.h"
+#include "battery.h"
+#include "oversample.h"
+#include "filter.h"
+
+String emoncms_node = "";
+String emoncms_fingerprint = "";
+String ipaddress = "";
+String ipaddress_OLED = "";
+String connected_network = "";
+unsigned long TimeButtonPressedExt = 0;
+unsigned long boot_sample_ms = 0;
+
+void gpio0_setup() {}
+void stream_sample(const uint16_t *) {}
+void checkpoint_save(void) {}
+void config_save_autozero() {}
+
+// what config_load_settings() ends with on a blank EEPROM.
+void config_load_settings() {
+  battery_configure();
+  oversample_configure();
+  sampler_set_schedule(sampler_divider);
+  filter_configure();
+}
+
+#if !defined(PIO_UNIT_TESTING) && !defined(EMONDC_REPLAY)
+
+// one loop() pass per simulated millisecond, the board manages several.
+#define NATIVE_PASS_US 1000
+
+int main(int argc, char **argv) {
+  uint32_t seconds = argc > 1 ? atoi(argv[1]) : 60;
+  const char *sd_dir = argc > 2 ? argv[2] : "sd";
+  hal_sd_root(sd_dir);
+  hal_rtc_set(1598918400); // 2020-09-01 00:00 UTC, the RTC path sets the clock.
+
+  // a flat battery bank at 1/2 scale and a charge current at 1/4 scale.
+  const uint16_t levels[8] = {3072, 2048, 3072, 2048, 2048, 0, 2540, 0};
+  for (uint8_t ch = 0; ch < 8; ch++) hal_mcp3208_values[ch] = levels[ch];
+
+  config_load_settings();
+  emondc_setup();
+  printf("sample rate %u Hz, interval %u s, SD card in %s\n", sample_rate_hz, readings_interval, SD_present ? sd_dir : "none");
+  printf("   t(s)  samples/s  ns/sample  pass ns (max)     allocs  bytes  heap min  isr ns max\n");
+
+  // micros() is simulated, so loop_interval_us reads 0 here: the passes are
+  // timed in host ns instead, the longest is the one that ran the interval.
+  uint64_t total_ns = 0;
+  uint64_t passes = 0;
+  uint64_t report_ns = 0;
+  uint64_t report_passes = 0;
+  uint64_t report_max_ns = 0;
+  uint64_t allocations = hal_heap_allocations;
+  uint64_t bytes = hal_heap_bytes;
+  uint32_t noise = 1;
+  while (hal_now_us() < (uint64_t)seconds * 1000000) {
+    hal_advance_us(NATIVE_PASS_US);
+    // +-2 counts on the currents, so the averages are not all round numbers.
+    noise = noise * 1103515245 + 12345;
+    hal_mcp3208_values[0] = levels[0] + ((noise >> 16) % 5) - 2;
+    hal_mcp3208_values[2] = levels[2] + ((noise >> 24) % 5) - 2;
+
+    uint64_t start = hal_host_ns();
+    emondc_loop();
+    uint64_t pass_ns = hal_host_ns() - start;
+    report_ns += pass_ns;
+    report_passes++;
+    if (pass_ns > report_max_ns) report_max_ns = pass_ns;
+
+    if (loop_samples_hz != 0) { // a post went out on this pass.
+      printf("%7lu  %9.1f  %9u  %6lu (%7lu)  %6lu  %5lu  %8u  %10u\n", (unsigned long)(hal_now_us() / 1000000), loop_samples_hz,
+             loop_sample_cycles, (unsigned long)(report_ns / report_passes), (unsigned long)report_max_ns,
+             (unsigned long)(hal_heap_allocations - allocations), (unsigned long)(hal_heap_bytes - bytes), loop_heap_min,
+             sampler_cycles_max);
+      loop_samples_hz = 0;
+      total_ns += report_ns;
+      passes += report_passes;
+      report_ns = 0;
+      report_passes = 0;
+      report_max_ns = 0;
+      allocations = hal_heap_allocations;
+      bytes = hal_heap_bytes;
+    }
+  }
+  emondc_shutdown();
+  printf("%llu passes, %.0f ns/pass, overruns %lu, underruns %lu, SPI clocks %llu, selects %llu\n",
+         (unsigned long long)passes, passes ? (double)total_ns / passes : 0.0, sampler_overruns, sampler_underruns,
+         (unsigned long long)hal_spi_clocks, (unsigned long long)hal_spi_selects);
+  return 0;
+}
+
+#endif // !PIO_UNIT_TESTING && !EMONDC_REPLAY
+#endif // EMONDC_NATIVE
@@ -28,6 +28,8 @@
 #include "web_server.h"
 #include "wifi.h"
 #include "http.h"
+#include "sampler.h"
+#include "emondc.h"
 
 #include <ArduinoOTA.h>               // local OTA update from Arduino IDE
 #include <ESP8266httpUpdate.h>        // remote OTA update from server
@@ -50,6 +52,10 @@ void ota_setup()
   // Start local OTA update server
   ArduinoOTA.setHostname(esp_hostname);
   ArduinoOTA.setPassword(ota_pass);
+  // no sampling while flash is written.
+  ArduinoOTA.onStart([]() { sampler_bus_acquire(); });
+  ArduinoOTA.onEnd([]() { emondc_shutdown(); }); // the totals before the restart into the new firmware.
+  ArduinoOTA.onError([](ota_error_t error) { sampler_bus_release(); });
   ArduinoOTA.begin();
 }
 
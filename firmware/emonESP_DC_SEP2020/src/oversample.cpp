@@ -0,0 +1,138 @@
+// emonDC oversampling and decimation, free to use and modify.
+
+// Each channel runs its own decimator at a ratio of 4^bits. The boxcar sums
+// the samples of each output and starts again. The CIC keeps two integrators
+// running and takes two combs at the output rate, a triangular window twice as
+// long that rejects more of the noise between outputs, for no more work per
+// sample. Its gain is ratio^2, both gains are powers of two so the outputs are
+// shifted, not divided, into Q8 counts. The integrators wrap, which the combs
+// undo as long as an output fits 32 bits, 4095 x 256^2 does.
+// The per sample work is integer only, the floating point stats are worked out
+// once per interval in oversample_finish.
+
+#include "oversample.h"
+#include "debug.h"
+
+uint8_t oversample_bits_A = 0;
+uint8_t oversample_bits_B = 0;
+uint8_t oversample_filter = OVERSAMPLE_BOXCAR;
+
+oversample_stats_t oversample_stats[OVERSAMPLE_CHANNELS];
+
+struct oversample_channel_t {
+  uint8_t bits;
+  uint16_t phase;      // samples into the current output.
+  uint8_t settle;      // outputs to skip while the filter fills.
+  uint32_t integ1;
+  uint32_t integ2;
+  uint32_t last_integ2;
+  uint32_t last_comb1;
+  // interval sums.
+  uint32_t raw_count;
+  uint64_t raw_sum;
+  uint64_t raw_sumsq;
+  uint32_t out_count;
+  int64_t out_sum;
+  uint64_t out_sumsq;
+  int32_t out_max;
+  int32_t out_min;
+};
+
+static oversample_channel_t oversample_channels[OVERSAMPLE_CHANNELS];
+
+
+void oversample_configure(void) {
+  if (oversample_bits_A > OVERSAMPLE_MAX_BITS) oversample_bits_A = OVERSAMPLE_MAX_BITS;
+  if (oversample_bits_B > OVERSAMPLE_MAX_BITS) oversample_bits_B = OVERSAMPLE_MAX_BITS;
+  if (oversample_filter > OVERSAMPLE_CIC2) oversample_filter = OVERSAMPLE_BOXCAR;
+  for (uint8_t ch = 0; ch < OVERSAMPLE_CHANNELS; ch++) {
+    oversample_channel_t &c = oversample_channels[ch];
+    c.bits = ch < 2 ? oversample_bits_A : oversample_bits_B;
+    c.phase = 0;
+    c.settle = oversample_filter == OVERSAMPLE_CIC2 ? 2 : 0;
+    c.integ1 = c.integ2 = c.last_integ2 = c.last_comb1 = 0;
+  }
+  oversample_reset();
+  DBUGF("oversample: bits A %u B %u filter %u", oversample_bits_A, oversample_bits_B, oversample_filter);
+}
+
+void oversample_reset(void) {
+  for (uint8_t ch = 0; ch < OVERSAMPLE_CHANNELS; ch++) {
+    oversample_channel_t &c = oversample_channels[ch];
+    c.raw_count = 0;
+    c.raw_sum = 0;
+    c.raw_sumsq = 0;
+    c.out_count = 0;
+    c.out_sum = 0;
+    c.out_sumsq = 0;
+    c.out_max = INT32_MIN;
+    c.out_min = INT32_MAX;
+  }
+}
+
+void oversample_sample(const uint16_t *readings, uint8_t fresh) {
+  for (uint8_t ch = 0; ch < OVERSAMPLE_CHANNELS; ch++) {
+    if (!(fresh & (1 << ch))) continue; // a held reading would understate the noise.
+    oversample_channel_t &c = oversample_channels[ch];
+    uint16_t x = readings[ch];
+    c.raw_count++;
+    c.raw_sum += x;
+    c.raw_sumsq += (uint32_t)x * x;
+
+    c.integ1 += x;
+    if (oversample_filter == OVERSAMPLE_CIC2) c.integ2 += c.integ1;
+    if (++c.phase < (1U << (2 * c.bits))) continue;
+    c.phase = 0;
+
+    int32_t out_q8;
+    if (oversample_filter == OVERSAMPLE_CIC2) {
+      uint32_t comb1 = c.integ2 - c.last_integ2;
+      c.last_integ2 = c.integ2;
+      uint32_t comb2 = comb1 - c.last_comb1;
+      c.last_comb1 = comb1;
+      out_q8 = (int32_t)(((uint64_t)comb2 << 8) >> (4 * c.bits));
+    } else {
+      out_q8 = (int32_t)(((uint64_t)c.integ1 << 8) >> (2 * c.bits));
+      c.integ1 = 0;
+    }
+    if (c.settle > 0) {
+      c.settle--;
+      continue;
+    }
+
+    c.out_count++;
+    c.out_sum += out_q8;
+    c.out_sumsq += (uint64_t)((int64_t)out_q8 * out_q8);
+    if (out_q8 > c.out_max) c.out_max = out_q8;
+    if (out_q8 < c.out_min) c.out_min = out_q8;
+  }
+}
+
+void oversample_finish(void) {
+  for (uint8_t ch = 0; ch < OVERSAMPLE_CHANNELS; ch++) {
+    oversample_channel_t &c = oversample_channels[ch];
+    oversample_stats_t &s = oversample_stats[ch];
+    if (c.raw_count == 0) continue;
+
+    double raw_mean = (double)c.raw_sum / c.raw_count;
+    double raw_var = (double)c.raw_sumsq / c.raw_count - raw_mean * raw_mean;
+    s.noise_lsb = raw_var > 0 ? sqrt(raw_var) : 0;
+
+    if (c.out_count == 0) {
+      // interval shorter than one output, fall back to the raw mean.
+      s.max_q8 = s.min_q8 = (int32_t)(raw_mean * 256);
+      s.noise_out_lsb = s.noise_lsb;
+    } else {
+      s.max_q8 = c.out_max;
+      s.min_q8 = c.out_min;
+      double out_mean = (double)c.out_sum / c.out_count;
+      double out_var = (double)c.out_sumsq / c.out_count - out_mean * out_mean;
+      s.noise_out_lsb = out_var > 0 ? sqrt(out_var) / 256 : 0;
+    }
+
+    // quantisation floor: the output's own step when dithered, the ADC's when not.
+    double step = s.noise_lsb >= OVERSAMPLE_DITHER_LSB ? 1.0 / (1 << c.bits) : 1.0;
+    double rms = sqrt((double)s.noise_out_lsb * s.noise_out_lsb + step * step / 12);
+    s.enob = log2(4096 / (rms * sqrt(12)));
+  }
+}
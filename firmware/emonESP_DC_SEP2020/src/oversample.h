@@ -0,0 +1,46 @@
+// emonDC oversampling and decimation, free to use and modify.
+
+#ifndef _EMONDC_OVERSAMPLE_H
+#define _EMONDC_OVERSAMPLE_H
+
+#include <Arduino.h>
+
+// Channels 0-3 (A current, A voltage, B current, B voltage) are decimated by
+// 4^bits samples per output, which gives `bits` extra bits of resolution when
+// there is enough noise on the input to dither the ADC. The averages already
+// keep 8 fractional bits, the decimated outputs set the max and min values and
+// the noise and ENOB figures, so the bits trade peak bandwidth for resolution.
+#define OVERSAMPLE_CHANNELS 4
+#define OVERSAMPLE_MAX_BITS 4
+// raw noise, as rms LSB, below which the ADC is not dithered and oversampling adds no real bits.
+#define OVERSAMPLE_DITHER_LSB 0.5
+
+enum oversample_filter_t { OVERSAMPLE_BOXCAR = 0, OVERSAMPLE_CIC2 = 1 };
+
+// extra bits for the channel A pair and channel B pair, and the filter for both.
+extern uint8_t oversample_bits_A;
+extern uint8_t oversample_bits_B;
+extern uint8_t oversample_filter;
+
+// Per channel, over the last averaging interval. The noise figures only mean
+// something while the input is steady, any change in it counts as noise.
+struct oversample_stats_t {
+  int32_t max_q8;       // decimated extremes, counts in Q8.
+  int32_t min_q8;
+  float noise_lsb;      // raw samples, rms about their mean.
+  float noise_out_lsb;  // decimated outputs, rms about their mean.
+  float enob;           // effective bits of the decimated outputs.
+};
+
+extern oversample_stats_t oversample_stats[OVERSAMPLE_CHANNELS];
+
+// Apply the bits and filter settings, restarts the filters.
+void oversample_configure(void);
+// Add the channels of a raw sample set that were read on this pass, see sampler.h.
+void oversample_sample(const uint16_t *readings, uint8_t fresh);
+// Work out the stats for the interval, before the max and min are used.
+void oversample_finish(void);
+// Start the next interval's stats, the filters carry on.
+void oversample_reset(void);
+
+#endif // _EMONDC_OVERSAMPLE_H
@@ -0,0 +1,134 @@
+// emonDC emoncms backlog replay, free to use and modify.
+
+// Every live measurement emoncms accepts moves replay_acked on. When one is
+// accepted after a gap, from WiFi or emoncms being down or the retry queue
+// overflowing, the rows logged to the SD card in between are posted again to
+// /input/bulk.json, a few at a time, whenever the live queue is empty. See
+// emoncms.cpp for the posting.
+// Only dated log files are replayed, rows without RTC time can't be placed.
+// HTTPS posts are blocking and GET only, so with an HTTPS server the backlog
+// is held, and /status says so, until a plain HTTP server is set.
+
+#include "replay.h"
+#include "sdlog.h"
+#include "emondc.h"
+#include "config.h"
+#include "sampler.h"
+
+#include <SD.h>
+#include <RTClib.h>
+
+uint32_t replay_acked = 0;
+uint32_t replay_from = 0;
+uint32_t replay_until = 0;
+unsigned long replay_rows_sent = 0;
+
+static sdlog_row_t replay_rows[REPLAY_BATCH_ROWS];
+static uint16_t replay_row_count = 0;
+static uint32_t replay_day = 0;   // midnight of the log file being read.
+static uint32_t replay_block = 0; // where to carry on in it.
+static uint32_t replay_saved = 0;
+static unsigned long replay_savedMillis = 0;
+
+
+//-------------------------
+// Acknowledged time
+//-------------------------
+void replay_setup(void) {
+  if (!SD_present) return;
+  SamplerBusLock busLock;
+  File ackFile = SD.open(REPLAY_ACK_FILE, FILE_READ);
+  if (!ackFile) return;
+  uint32_t acked;
+  if (ackFile.read((uint8_t *)&acked, sizeof(acked)) == sizeof(acked)) {
+    replay_acked = acked;
+    replay_saved = acked;
+  }
+  ackFile.close();
+  Serial.print("replay_acked:"); Serial.println(replay_acked);
+}
+
+void replay_save(void) {
+  // while replaying, resume from the replay position rather than skip the rest of it.
+  uint32_t acked = replay_until ? replay_from : replay_acked;
+  replay_savedMillis = millis();
+  if (!SD_present || acked == replay_saved) return;
+  SamplerBusLock busLock;
+  SD.remove(REPLAY_ACK_FILE);
+  File ackFile = SD.open(REPLAY_ACK_FILE, FILE_WRITE);
+  if (!ackFile) return;
+  ackFile.write((const uint8_t *)&acked, sizeof(acked));
+  ackFile.close();
+  replay_saved = acked;
+}
+
+void replay_loop(void) {
+  if (millis() - replay_savedMillis >= REPLAY_SAVE_INTERVAL_MS) replay_save();
+}
+
+bool replay_held(void) {
+  return replay_until != 0 && emoncms_fingerprint != "";
+}
+
+void replay_acknowledged(uint32_t time) {
+  if (time <= replay_acked) return;
+  if (replay_acked > 0 && time - replay_acked > 2UL * main_interval_seconds) {
+    if (replay_until == 0) {
+      replay_from = replay_acked;
+      replay_day = replay_acked - replay_acked % 86400UL;
+      replay_block = 0;
+      replay_row_count = 0;
+    }
+    replay_until = time; // a gap while replaying is covered by carrying on further.
+    replay_save();
+  }
+  replay_acked = time;
+}
+
+
+//-------------------------
+// Batches
+//-------------------------
+uint16_t replay_batch(void) {
+  if (replay_until == 0 || replay_row_count > 0) return replay_row_count;
+
+  while (replay_day < replay_until) {
+    DateTime day(replay_day);
+    char filename[20]; // 14 characters, the warnings allow for any uint16_t year.
+    snprintf(filename, sizeof(filename), "%04d-%02d-%02d.bin", day.year(), day.month(), day.day());
+    replay_row_count = sdlog_read_rows(filename, replay_from, replay_until, replay_block,
+                                       replay_rows, REPLAY_BATCH_ROWS);
+    if (replay_row_count > 0) return replay_row_count;
+    // this day is done, rows are only filtered by time so none are lost at midnight.
+    replay_day += 86400UL;
+    replay_block = 0;
+  }
+
+  Serial.print("replay done, rows:"); Serial.println(replay_rows_sent);
+  replay_until = 0;
+  replay_save();
+  return 0;
+}
+
+size_t replay_format(uint16_t row, char *buffer, size_t size) {
+  // longest row is the time, the node name and 26 fields of ,{"name":-2147483.648}
+  if (size < 48 + emoncms_node.length() + MEAS_FIELDS * 28) return 0;
+  const sdlog_row_t &r = replay_rows[row];
+  size_t len = sprintf(buffer, "%s[%lu,\"%s\"", row == 0 ? "data=[" : ",", (unsigned long)r.time, emoncms_node.c_str());
+  for (uint8_t i = 0; i < MEAS_FIELDS; i++) {
+    len += sprintf(buffer + len, ",{\"%s\":", measurement_name((meas_field_t)i));
+    len += measurement_format_fixed(buffer + len, r.field[i], measurement_exponent((meas_field_t)i));
+    buffer[len++] = '}';
+  }
+  buffer[len++] = ']';
+  if (row == replay_row_count - 1) buffer[len++] = ']';
+  buffer[len] = 0;
+  return len;
+}
+
+void replay_batch_done(void) {
+  if (replay_row_count == 0) return;
+  replay_from = replay_rows[replay_row_count - 1].time;
+  replay_rows_sent += replay_row_count;
+  replay_row_count = 0;
+}
@@ -0,0 +1,49 @@
+// emonDC emoncms backlog replay, free to use and modify.
+
+#ifndef _EMONDC_REPLAY_H
+#define _EMONDC_REPLAY_H
+
+#include <Arduino.h>
+
+// Rows per /input/bulk.json post, and the least time between posts.
+#ifndef REPLAY_BATCH_ROWS
+#define REPLAY_BATCH_ROWS 4
+#endif
+#ifndef REPLAY_INTERVAL_MS
+#define REPLAY_INTERVAL_MS 2000UL
+#endif
+// the acknowledged time is saved to the SD card at most this often.
+#define REPLAY_SAVE_INTERVAL_MS 600000UL
+#define REPLAY_ACK_FILE "replay.ack"
+
+// last measurement time emoncms accepted, and the backlog being sent: rows
+// logged after replay_from and before replay_until, replay_until is 0 when
+// there is none.
+extern uint32_t replay_acked;
+extern uint32_t replay_from;
+extern uint32_t replay_until;
+extern unsigned long replay_rows_sent;
+
+// A backlog is kept but not sent: the replay posts over the async HTTP client
+// only, so it waits while an HTTPS server (a fingerprint) is configured.
+bool replay_held(void);
+
+// Read the saved acknowledged time, after the SD card is up.
+void replay_setup(void);
+// Save the acknowledged time when it is due, or now.
+void replay_loop(void);
+void replay_save(void);
+
+// emoncms accepted a live measurement taken at time, starts a replay if it
+// follows a gap in what was accepted.
+void replay_acknowledged(uint32_t time);
+
+// Rows in the batch to send, loading the next batch from the SD log when the
+// last one was accepted. 0 when there is nothing to replay.
+uint16_t replay_batch(void);
+// Text of one batch row as part of the "data=[...]" post body, returns its length.
+size_t replay_format(uint16_t row, char *buffer, size_t size);
+// emoncms accepted the batch, move on past it.
+void replay_batch_done(void);
+
+#endif // _EMONDC_REPLAY_H
@@ -0,0 +1,177 @@
+// emonDC timer driven ADC sampler, free to use and modify.
+
+// timer1 fires at sample_rate_hz and the ISR reads all MCP3208 channels into a
+// single-producer/single-consumer ring buffer, emondc_loop() drains it.
+// Sampling therefore carries on at a fixed rate while loop() is busy posting.
+// Not every channel is read every pass: the references and CH8 barely move, so
+// the schedule reads them less often and leaves the SPI time to the currents
+// and voltages, which can then be sampled faster. The channels to read on each
+// pass come from a table, so the ISR does no division.
+// The ISR and everything it calls are in IRAM and touch no flash, so it can
+// fire while the SDK writes flash (EEPROM, WiFi config, OTA). The bus lock is
+// only for sharing the SPI bus with the SD card.
+// A pass reading all 8 channels must fit the shortest tick with room to spare,
+// which the ADC clock decides. Each pass is timed as well, and a rate the
+// passes turn out too slow for is lowered to one they fit, not saved.
+
+#include "sampler.h"
+#include "AH_MCP320x.h"
+#include "simadc.h"
+
+extern AH_MCP320x ADC_SPI;
+
+// passes per second. The default schedule reads about 4.2 channels a pass, 25us
+// each at SAMPLER_ADC_HZ, about 105us of each 1250us tick or 8% of the CPU;
+// a pass of all 8 takes about 200us. sampler_finish() lowers it if not.
+uint16_t sample_rate_hz = 800;
+volatile unsigned long sampler_overruns = 0;
+volatile unsigned long sampler_underruns = 0;
+uint32_t sampler_cycles = 0;
+uint32_t sampler_cycles_max = 0;
+// currents and voltages every pass, references every 16th, CH8 once per interval.
+uint8_t sampler_divider[SAMPLER_CHANNELS] = {1, 1, 1, 1, 16, 16, 16, SAMPLER_ONCE};
+
+static adc_sample_t sampler_buffer[SAMPLER_BUFFER_SIZE];
+static volatile uint16_t sampler_head = 0; // written by the ISR only.
+static volatile uint16_t sampler_tail = 0; // written by sampler_read() only.
+static volatile uint8_t sampler_bus_lock = 0;
+static bool sampler_running = false;
+static uint8_t sampler_masks[SAMPLER_SCHEDULE_PASSES]; // channels to read on each pass.
+static uint8_t sampler_pass = 0;
+static volatile uint8_t sampler_once = 0xFF; // every channel on the first pass.
+static uint16_t sampler_last[SAMPLER_CHANNELS];
+// written by the ISR only, read and cleared by sampler_finish().
+static volatile uint64_t sampler_cycles_sum = 0;
+static volatile uint32_t sampler_passes = 0;
+static volatile uint32_t sampler_cycles_peak = 0;
+
+#define SAMPLER_TIMER_HZ 5000000UL // 80MHz / TIM_DIV16
+#define SAMPLER_BARRIER() __asm__ __volatile__("" ::: "memory")
+
+// 24 bus clocks and the 500ns tCSH per channel, in ns.
+#define SAMPLER_CHANNEL_NS (24 * 1000000000ULL / SAMPLER_ADC_HZ + 500)
+static_assert(SAMPLER_CHANNELS * SAMPLER_CHANNEL_NS <= 1000000000ULL / SAMPLER_RATE_MAX / 2,
+              "8 channels at SAMPLER_ADC_HZ take over half the tick at SAMPLER_RATE_MAX");
+
+void IRAM_ATTR sampler_isr() {
+  uint32_t start = ESP.getCycleCount();
+  if (sampler_bus_lock) {
+    sampler_underruns++;
+    return;
+  }
+  uint16_t next = (sampler_head + 1) & (SAMPLER_BUFFER_SIZE - 1);
+  if (next == sampler_tail) {
+    sampler_overruns++;
+    return;
+  }
+  uint8_t mask = sampler_masks[sampler_pass++ & (SAMPLER_SCHEDULE_PASSES - 1)] | sampler_once;
+  sampler_once = 0;
+#ifdef EMONDC_SIM_ADC
+  simadc_read_burst(sampler_last, mask);
+#else
+  ADC_SPI.readBurst(sampler_last, mask);
+#endif
+  for (uint8_t ch = 0; ch < SAMPLER_CHANNELS; ch++) {
+    sampler_buffer[sampler_head].ch[ch] = sampler_last[ch]; // memcpy is not in IRAM.
+  }
+  sampler_buffer[sampler_head].fresh = mask;
+  SAMPLER_BARRIER(); // sample written before it is published.
+  sampler_head = next;
+  uint32_t cycles = ESP.getCycleCount() - start;
+  sampler_cycles_sum += cycles;
+  sampler_passes++;
+  if (cycles > sampler_cycles_peak) sampler_cycles_peak = cycles;
+}
+
+void sampler_setup(void) {
+  sampler_head = 0;
+  sampler_tail = 0;
+  sampler_set_schedule(sampler_divider);
+  timer1_attachInterrupt(sampler_isr);
+  sampler_start();
+}
+
+void sampler_start(void) {
+  if (sample_rate_hz == 0) return;
+  timer1_enable(TIM_DIV16, TIM_EDGE, TIM_LOOP);
+  timer1_write(SAMPLER_TIMER_HZ / sample_rate_hz);
+  sampler_running = true;
+}
+
+void sampler_stop(void) {
+  timer1_disable();
+  sampler_running = false;
+}
+
+void sampler_set_rate(uint16_t rate_hz) {
+  sample_rate_hz = rate_hz;
+  if (sampler_running) sampler_start();
+}
+
+void sampler_set_schedule(const uint8_t *dividers) {
+  uint8_t divider[SAMPLER_CHANNELS];
+  for (uint8_t ch = 0; ch < SAMPLER_CHANNELS; ch++) {
+    uint16_t d = dividers[ch];
+    if (d > SAMPLER_SCHEDULE_PASSES) d = SAMPLER_SCHEDULE_PASSES;
+    if (d != SAMPLER_ONCE) {
+      while (d & (d - 1)) d &= d - 1; // round down to a power of two.
+    }
+    divider[ch] = d;
+  }
+  sampler_bus_acquire(); // no pass while the table is half written.
+  memcpy(sampler_divider, divider, sizeof(sampler_divider));
+  for (uint16_t pass = 0; pass < SAMPLER_SCHEDULE_PASSES; pass++) {
+    uint8_t mask = 0;
+    for (uint8_t ch = 0; ch < SAMPLER_CHANNELS; ch++) {
+      if (divider[ch] != SAMPLER_ONCE && (pass & (divider[ch] - 1)) == 0) mask |= 1 << ch;
+    }
+    sampler_masks[pass] = mask;
+  }
+  sampler_once = 0xFF; // fresh readings all round for the channels not read for a while.
+  sampler_bus_release();
+}
+
+void sampler_request_once(void) {
+  uint8_t once = 0;
+  for (uint8_t ch = 0; ch < SAMPLER_CHANNELS; ch++) {
+    if (sampler_divider[ch] == SAMPLER_ONCE) once |= 1 << ch;
+  }
+  sampler_once |= once;
+}
+
+bool sampler_read(adc_sample_t &sample) {
+  uint16_t tail = sampler_tail;
+  if (tail == sampler_head) return false;
+  sample = sampler_buffer[tail];
+  SAMPLER_BARRIER(); // sample copied before the slot is handed back.
+  sampler_tail = (tail + 1) & (SAMPLER_BUFFER_SIZE - 1);
+  return true;
+}
+
+bool sampler_finish(void) {
+  sampler_cycles = sampler_passes ? sampler_cycles_sum / sampler_passes : 0;
+  sampler_cycles_max = sampler_cycles_peak;
+  sampler_cycles_sum = 0; // a pass between these is lost, its interval is over anyway.
+  sampler_passes = 0;
+  sampler_cycles_peak = 0;
+  if (sample_rate_hz == 0 || sampler_cycles == 0) return true;
+
+  uint32_t cpu_hz = ESP.getCpuFreqMHz() * 1000000UL;
+  uint32_t rate = cpu_hz / SAMPLER_ISR_SHARE / sampler_cycles;
+  if (sampler_cycles_max > 0 && cpu_hz / sampler_cycles_max < rate) rate = cpu_hz / sampler_cycles_max;
+  if (rate >= sample_rate_hz) return true;
+  sampler_set_rate(rate < SAMPLER_RATE_MIN ? SAMPLER_RATE_MIN : rate);
+  return false;
+}
+
+uint16_t sampler_available(void) {
+  return (sampler_head - sampler_tail) & (SAMPLER_BUFFER_SIZE - 1);
+}
+
+void sampler_bus_acquire(void) {
+  sampler_bus_lock++;
+}
+
+void sampler_bus_release(void) {
+  if (sampler_bus_lock) sampler_bus_lock--;
+}
@@ -0,0 +1,70 @@
+// emonDC timer driven ADC sampler, free to use and modify.
+
+#ifndef _EMONDC_SAMPLER_H
+#define _EMONDC_SAMPLER_H
+
+#include <Arduino.h>
+
+// ring buffer length in samples, must be a power of two. 160ms at the default rate.
+#define SAMPLER_BUFFER_SIZE 128
+
+#define SAMPLER_CHANNELS 8
+// Each channel is read every `divider` passes, a power of two up to
+// SAMPLER_SCHEDULE_PASSES, or SAMPLER_ONCE for once per readings interval.
+#define SAMPLER_SCHEDULE_PASSES 128
+#define SAMPLER_ONCE 0
+
+// sample_rate_hz limits, as the config page takes them.
+#define SAMPLER_RATE_MIN 10
+#define SAMPLER_RATE_MAX 2000
+// The MCP3208's clock for the sampler's reads, its own: the SD card shares the
+// bus at a slower one. The datasheet gives 2MHz at 5V and 1MHz at 2.7V, the
+// ADC here runs from about 3.3V.
+#define SAMPLER_ADC_HZ 1000000UL
+// The ISR may take this fraction of the CPU, 1/n, WiFi and loop() the rest.
+#define SAMPLER_ISR_SHARE 4
+
+struct adc_sample_t {
+  uint16_t ch[SAMPLER_CHANNELS]; // channels not read this pass hold their last reading.
+  uint8_t fresh;                 // bit per channel read this pass.
+};
+
+extern uint8_t sampler_divider[SAMPLER_CHANNELS];
+
+extern uint16_t sample_rate_hz;
+// samples dropped because the ring buffer was full (emondc_loop fell behind).
+extern volatile unsigned long sampler_overruns;
+// sample ticks missed because the SPI bus or flash was in use elsewhere.
+extern volatile unsigned long sampler_underruns;
+// average and longest ISR pass of the last readings interval, in CPU cycles.
+extern uint32_t sampler_cycles;
+extern uint32_t sampler_cycles_max;
+
+void sampler_setup(void);
+void sampler_start(void);
+void sampler_stop(void);
+void sampler_set_rate(uint16_t rate_hz);
+bool sampler_read(adc_sample_t &sample);
+// Set the passes per reading of each channel, rounded down to a power of two.
+void sampler_set_schedule(const uint8_t *dividers);
+// Read the SAMPLER_ONCE channels on the next pass, call at the start of each interval.
+void sampler_request_once(void);
+uint16_t sampler_available(void);
+// End of a readings interval: take the pass times, and lower sample_rate_hz
+// until the average pass takes no more than its share of the CPU, nor the
+// longest one more than the tick. False if the rate was lowered.
+bool sampler_finish(void);
+
+// Hold off the sampling ISR while the SPI bus (SD card) is in use, or for an OTA update.
+void sampler_bus_acquire(void);
+void sampler_bus_release(void);
+
+// Scoped acquire/release, for handlers with several return paths.
+class SamplerBusLock
+{
+  public:
+    SamplerBusLock() { sampler_bus_acquire(); }
+    ~SamplerBusLock() { sampler_bus_release(); }
+};
+
+#endif // _EMONDC_SAMPLER_H
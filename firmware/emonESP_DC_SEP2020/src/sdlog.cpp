@@ -0,0 +1,314 @@
+// emonDC binary SD card log, free to use and modify.
+
+// Rows are fixed size int32 records, so nothing but the values is written per
+// post. They are staged in RAM and the card only sees whole 512-byte blocks,
+// written to a file kept open when the staging buffer fills, or once the
+// oldest row is SDLOG_FLUSH_INTERVAL_MS old.
+// /sd/export turns a log back into CSV on the fly, see web_server.cpp.
+
+#include "sdlog.h"
+#include "sampler.h"
+
+#include <SD.h>
+
+static_assert(sizeof(sdlog_header_t) <= SDLOG_BLOCK_SIZE, "sdlog header must fit one block");
+
+// write side, staging blocks filled in turn and written together.
+static uint8_t sdlog_buffer[SDLOG_BUFFER_BLOCKS][SDLOG_BLOCK_SIZE];
+static uint8_t sdlog_blocks = 0;   // complete blocks waiting.
+static uint16_t sdlog_rows = 0;    // rows in the block being filled.
+static unsigned long sdlog_oldestMillis = 0;
+static char sdlog_filename[20] = "";
+static File sdlog_file;            // kept open between flushes.
+unsigned long sdlog_flush_us = 0;
+unsigned long sdlog_flush_us_max = 0;
+
+// export side.
+#define SDLOG_LINE_SIZE 400
+static File sdlog_export_file;
+static bool sdlog_exporting = false;
+static uint8_t sdlog_export_block[SDLOG_BLOCK_SIZE];
+static uint16_t sdlog_export_rows = 0;
+static uint16_t sdlog_export_row = 0;
+static uint16_t sdlog_export_row_size = 0;
+static uint16_t sdlog_export_fields = 0;
+static int8_t sdlog_export_exponent[MEAS_FIELDS];
+static char sdlog_line[SDLOG_LINE_SIZE];
+static uint16_t sdlog_line_len = 0;
+static uint16_t sdlog_line_pos = 0;
+
+
+//-------------------------
+// Writing
+//-------------------------
+static void sdlog_write_header(File &dataFile) {
+  uint8_t block[SDLOG_BLOCK_SIZE];
+  memset(block, 0, sizeof(block));
+  sdlog_header_t *header = (sdlog_header_t *)block;
+  memcpy(header->magic, SDLOG_MAGIC, sizeof(SDLOG_MAGIC));
+  header->row_size = sizeof(sdlog_row_t);
+  header->field_count = MEAS_FIELDS;
+  for (int i = 0; i < MEAS_FIELDS; i++) {
+    strncpy(header->field[i].name, measurement_name((meas_field_t)i), SDLOG_NAME_SIZE);
+    header->field[i].exponent = measurement_exponent((meas_field_t)i);
+  }
+  dataFile.write(block, SDLOG_BLOCK_SIZE);
+}
+
+static void sdlog_seal_block(void) {
+  sdlog_block_header_t *block_header = (sdlog_block_header_t *)sdlog_buffer[sdlog_blocks];
+  block_header->rows = sdlog_rows;
+  block_header->row_size = sizeof(sdlog_row_t);
+  sdlog_blocks++;
+  sdlog_rows = 0;
+}
+
+void sdlog_flush(void) {
+  if (sdlog_rows > 0) sdlog_seal_block(); // a short block, rows count says how much of it is used.
+  if (sdlog_blocks == 0) return;
+
+  unsigned long start = micros();
+  SamplerBusLock busLock; // keep the sampling ISR off the SPI bus.
+  if (!sdlog_file) {
+    bool new_file = !SD.exists(sdlog_filename);
+    sdlog_file = SD.open(sdlog_filename, FILE_WRITE);
+    if (sdlog_file && new_file) sdlog_write_header(sdlog_file);
+  }
+  if (sdlog_file) {
+    sdlog_file.write(sdlog_buffer[0], sdlog_blocks * SDLOG_BLOCK_SIZE);
+    sdlog_file.flush(); // data first, then the directory entry, a power cut loses at most this flush.
+  }
+  else {
+    Serial.print("error opening ");
+    Serial.println(sdlog_filename);
+  }
+  memset(sdlog_buffer, 0, sdlog_blocks * SDLOG_BLOCK_SIZE);
+  sdlog_blocks = 0;
+
+  sdlog_flush_us = micros() - start;
+  if (sdlog_flush_us > sdlog_flush_us_max) sdlog_flush_us_max = sdlog_flush_us;
+}
+
+void sdlog_close(void) {
+  sdlog_flush();
+  if (sdlog_file) {
+    SamplerBusLock busLock;
+    sdlog_file.close();
+  }
+}
+
+void sdlog_append(const char *filename, const Measurement &m) {
+  if (strcmp(filename, sdlog_filename) != 0) { // date changed, finish the old file.
+    sdlog_close();
+    strncpy(sdlog_filename, filename, sizeof(sdlog_filename) - 1);
+  }
+  if (sdlog_blocks == 0 && sdlog_rows == 0) sdlog_oldestMillis = millis();
+
+  sdlog_row_t *row = (sdlog_row_t *)(sdlog_buffer[sdlog_blocks] + sizeof(sdlog_block_header_t)) + sdlog_rows;
+  row->time = m.time;
+  memcpy(row->field, m.value, sizeof(row->field));
+  sdlog_rows++;
+  if (sdlog_rows >= SDLOG_ROWS_PER_BLOCK) {
+    sdlog_seal_block();
+    if (sdlog_blocks >= SDLOG_BUFFER_BLOCKS) sdlog_flush();
+  }
+}
+
+void sdlog_loop(void) {
+  if ((sdlog_blocks > 0 || sdlog_rows > 0) && millis() - sdlog_oldestMillis >= SDLOG_FLUSH_INTERVAL_MS) {
+    sdlog_flush();
+  }
+}
+
+uint16_t sdlog_buffered_rows(void) {
+  return sdlog_blocks * SDLOG_ROWS_PER_BLOCK + sdlog_rows;
+}
+
+
+//-------------------------
+// Reading back
+//-------------------------
+static uint8_t sdlog_read_block[SDLOG_BLOCK_SIZE];
+
+// Rows of a data block, 0 if it is not one of ours.
+static uint16_t sdlog_load_block(File &dataFile, uint32_t block) {
+  if (!dataFile.seek(block * SDLOG_BLOCK_SIZE)) return 0;
+  if (dataFile.read(sdlog_read_block, SDLOG_BLOCK_SIZE) != SDLOG_BLOCK_SIZE) return 0;
+  sdlog_block_header_t *block_header = (sdlog_block_header_t *)sdlog_read_block;
+  if (block_header->row_size != sizeof(sdlog_row_t) || block_header->rows > SDLOG_ROWS_PER_BLOCK) return 0;
+  return block_header->rows;
+}
+
+static const sdlog_row_t *sdlog_block_row(uint16_t row) {
+  return (const sdlog_row_t *)(sdlog_read_block + sizeof(sdlog_block_header_t)) + row;
+}
+
+// Rows of the file being written still in the staging buffer, they follow the
+// ones on the card. Read from RAM, a replay does not force a part-filled flush.
+static uint16_t sdlog_read_staged(uint32_t after, uint32_t before, sdlog_row_t *rows, uint16_t max_rows) {
+  uint16_t count = 0;
+  for (uint8_t b = 0; b <= sdlog_blocks && b < SDLOG_BUFFER_BLOCKS; b++) {
+    uint16_t n = (b < sdlog_blocks) ? ((sdlog_block_header_t *)sdlog_buffer[b])->rows : sdlog_rows;
+    const sdlog_row_t *staged = (const sdlog_row_t *)(sdlog_buffer[b] + sizeof(sdlog_block_header_t));
+    for (uint16_t i = 0; i < n && count < max_rows; i++) {
+      if (staged[i].time <= after) continue;
+      if (staged[i].time >= before) return count;
+      rows[count++] = staged[i];
+    }
+  }
+  return count;
+}
+
+uint16_t sdlog_read_rows(const char *filename, uint32_t after, uint32_t before, uint32_t &block,
+                         sdlog_row_t *rows, uint16_t max_rows) {
+  uint16_t count = 0;
+  bool finished = false; // a row at or past before was seen.
+  {
+    SamplerBusLock busLock;
+    File dataFile = SD.open(filename, FILE_READ);
+    if (dataFile) {
+      // only logs written with this row layout.
+      sdlog_header_t *header = (sdlog_header_t *)sdlog_read_block;
+      if (dataFile.read(sdlog_read_block, SDLOG_BLOCK_SIZE) != SDLOG_BLOCK_SIZE
+          || memcmp(header->magic, SDLOG_MAGIC, sizeof(SDLOG_MAGIC)) != 0
+          || header->row_size != sizeof(sdlog_row_t) || header->field_count != MEAS_FIELDS) {
+        dataFile.close();
+        return 0;
+      }
+      uint32_t blocks = dataFile.size() / SDLOG_BLOCK_SIZE;
+
+      // rows are in time order, so binary search for the first block ending after the start.
+      if (block == 0) {
+        uint32_t lo = 1, hi = blocks;
+        while (lo < hi) {
+          uint32_t mid = (lo + hi) / 2;
+          uint16_t n = sdlog_load_block(dataFile, mid);
+          if (n > 0 && sdlog_block_row(n - 1)->time > after) hi = mid;
+          else lo = mid + 1;
+        }
+        block = lo;
+      }
+
+      for (; block < blocks && count < max_rows; block++) {
+        uint16_t n = sdlog_load_block(dataFile, block);
+        for (uint16_t i = 0; i < n && count < max_rows; i++) {
+          const sdlog_row_t *row = sdlog_block_row(i);
+          if (row->time <= after) continue;
+          if (row->time >= before) {
+            block = blocks; // past the range, nothing more to read.
+            finished = true;
+            break;
+          }
+          rows[count++] = *row;
+        }
+        if (count == max_rows) break; // the rest of this block is for the next call.
+      }
+      dataFile.close();
+    }
+  }
+  // the block cursor stays at the end of the card's rows, a flush in the
+  // meantime adds blocks from there and rows already read are skipped by time.
+  if (!finished && count < max_rows && strcmp(filename, sdlog_filename) == 0) {
+    count += sdlog_read_staged(after, before, rows + count, max_rows - count);
+  }
+  return count;
+}
+
+
+//-------------------------
+// CSV export
+//-------------------------
+static bool sdlog_export_next_block(void) {
+  sdlog_export_rows = 0;
+  sdlog_export_row = 0;
+  if (sdlog_export_file.read(sdlog_export_block, SDLOG_BLOCK_SIZE) != SDLOG_BLOCK_SIZE) return false;
+  sdlog_block_header_t *block_header = (sdlog_block_header_t *)sdlog_export_block;
+  if (block_header->row_size != sdlog_export_row_size) return false;
+  if (sizeof(sdlog_block_header_t) + block_header->rows * sdlog_export_row_size > SDLOG_BLOCK_SIZE) return false;
+  sdlog_export_rows = block_header->rows;
+  return true;
+}
+
+// Fill sdlog_line with the next CSV row, false at the end of the file.
+static bool sdlog_export_next_line(void) {
+  while (sdlog_export_row >= sdlog_export_rows) {
+    if (!sdlog_export_next_block()) return false;
+  }
+  const uint8_t *row = sdlog_export_block + sizeof(sdlog_block_header_t) + sdlog_export_row * sdlog_export_row_size;
+  sdlog_export_row++;
+
+  uint32_t time;
+  memcpy(&time, row, sizeof(time));
+  uint16_t len = sprintf(sdlog_line, "%lu", (unsigned long)time);
+  for (uint16_t i = 0; i < sdlog_export_fields; i++) {
+    int32_t value;
+    memcpy(&value, row + sizeof(time) + i * sizeof(value), sizeof(value));
+    sdlog_line[len++] = ',';
+    len += measurement_format_fixed(sdlog_line + len, value, sdlog_export_exponent[i]);
+  }
+  sdlog_line[len++] = '\n';
+  sdlog_line_len = len;
+  sdlog_line_pos = 0;
+  return true;
+}
+
+bool sdlog_export_open(const String &path) {
+  if (sdlog_exporting) return false;
+  SamplerBusLock busLock;
+  sdlog_export_file = SD.open(path, FILE_READ);
+  if (!sdlog_export_file) return false;
+
+  sdlog_header_t *header = (sdlog_header_t *)sdlog_export_block;
+  if (sdlog_export_file.read(sdlog_export_block, SDLOG_BLOCK_SIZE) != SDLOG_BLOCK_SIZE
+      || memcmp(header->magic, SDLOG_MAGIC, sizeof(SDLOG_MAGIC)) != 0
+      || header->field_count > MEAS_FIELDS
+      || header->row_size < sizeof(uint32_t) + header->field_count * sizeof(int32_t)) {
+    sdlog_export_file.close();
+    return false;
+  }
+  sdlog_export_row_size = header->row_size;
+  sdlog_export_fields = header->field_count;
+
+  // CSV header line, from the file's own schema.
+  uint16_t len = sprintf(sdlog_line, "time");
+  for (uint16_t i = 0; i < sdlog_export_fields; i++) {
+    char name[SDLOG_NAME_SIZE + 1];
+    memcpy(name, header->field[i].name, SDLOG_NAME_SIZE);
+    name[SDLOG_NAME_SIZE] = 0;
+    sdlog_export_exponent[i] = header->field[i].exponent;
+    len += sprintf(sdlog_line + len, ",%s", name);
+  }
+  sdlog_line[len++] = '\n';
+  sdlog_line_len = len;
+  sdlog_line_pos = 0;
+  sdlog_export_rows = 0;
+  sdlog_export_row = 0;
+  sdlog_exporting = true;
+  return true;
+}
+
+size_t sdlog_export_read(uint8_t *buffer, size_t maxLen) {
+  if (!sdlog_exporting) return 0;
+  SamplerBusLock busLock;
+  size_t bytes = 0;
+  while (bytes < maxLen) {
+    if (sdlog_line_pos >= sdlog_line_len && !sdlog_export_next_line()) break;
+    size_t chunk = min((size_t)(sdlog_line_len - sdlog_line_pos), maxLen - bytes);
+    memcpy(buffer + bytes, sdlog_line + sdlog_line_pos, chunk);
+    sdlog_line_pos += chunk;
+    bytes += chunk;
+  }
+  if (bytes == 0) sdlog_export_close();
+  return bytes;
+}
+
+void sdlog_export_close(void) {
+  if (!sdlog_exporting) return;
+  SamplerBusLock busLock;
+  sdlog_export_file.close();
+  sdlog_exporting = false;
+}
+
+bool sdlog_export_busy(void) {
+  return sdlog_exporting;
+}
@@ -0,0 +1,76 @@
+// emonDC binary SD card log, free to use and modify.
+
+#ifndef _EMONDC_SDLOG_H
+#define _EMONDC_SDLOG_H
+
+#include <Arduino.h>
+#include "measurement.h"
+
+// The log file is a sequence of 512-byte blocks, matching the SD card sector.
+// Block 0 is the header, naming each column and its decimal exponent.
+// Each following block holds a block header and as many whole rows as fit.
+#define SDLOG_BLOCK_SIZE   512
+#define SDLOG_MAGIC        "EDCLOG1"
+#define SDLOG_NAME_SIZE    12
+
+// RAM staging, in blocks. Rows are written when it fills or the oldest row is this old.
+#ifndef SDLOG_BUFFER_BLOCKS
+#define SDLOG_BUFFER_BLOCKS 4
+#endif
+#ifndef SDLOG_FLUSH_INTERVAL_MS
+#define SDLOG_FLUSH_INTERVAL_MS 60000UL
+#endif
+
+struct sdlog_row_t {
+  uint32_t time; // unix time in dated files, seconds since boot otherwise.
+  int32_t field[MEAS_FIELDS]; // as in the Measurement, int32 scaled by 10^exponent.
+};
+
+struct sdlog_header_t {
+  char magic[8];
+  uint16_t row_size;
+  uint16_t field_count;
+  uint32_t reserved;
+  struct {
+    char name[SDLOG_NAME_SIZE];
+    int8_t exponent;
+    uint8_t reserved[3];
+  } field[MEAS_FIELDS];
+};
+
+struct sdlog_block_header_t {
+  uint16_t rows;
+  uint16_t row_size;
+};
+
+#define SDLOG_ROWS_PER_BLOCK ((SDLOG_BLOCK_SIZE - sizeof(sdlog_block_header_t)) / sizeof(sdlog_row_t))
+
+// last and worst time taken to write the staging buffer to the card.
+extern unsigned long sdlog_flush_us;
+extern unsigned long sdlog_flush_us_max;
+
+// Stage a measurement as a row of filename.
+void sdlog_append(const char *filename, const Measurement &m);
+// Write staged rows when the time bound has passed.
+void sdlog_loop(void);
+// Write staged rows now, including a part-filled block.
+void sdlog_flush(void);
+// Flush and close the log file, before a restart or another user of the file.
+void sdlog_close(void);
+uint16_t sdlog_buffered_rows(void);
+
+// Read rows with after < time < before from a log, into rows[max_rows].
+// block is where to start looking, 0 to search the file for it, and is left at
+// the block to carry on from. Returns the rows read, short once the log or the
+// range is finished. Rows of the file being written that are still staged in
+// RAM come after the card's, without a flush.
+uint16_t sdlog_read_rows(const char *filename, uint32_t after, uint32_t before, uint32_t &block,
+                         sdlog_row_t *rows, uint16_t max_rows);
+
+// CSV conversion of a binary log, one export at a time.
+bool sdlog_export_open(const String &path);
+size_t sdlog_export_read(uint8_t *buffer, size_t maxLen);
+void sdlog_export_close(void);
+bool sdlog_export_busy(void);
+
+#endif // _EMONDC_SDLOG_H
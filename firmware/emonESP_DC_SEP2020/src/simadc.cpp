@@ -0,0 +1,53 @@
+// emonDC simulated MCP3208, free to use and modify.
+
+// Integer only, without division, and in IRAM, it runs in the sampling ISR
+// like the SPI reads it stands in for. Only built into the sim environment,
+// IRAM is short. The defaults give channel A charging and channel B
+// discharging, both with ripple and a few counts of noise, around the
+// bidirectional reference.
+
+#include "simadc.h"
+
+#ifdef EMONDC_SIM_ADC
+
+#define SIMADC_SEED 0x2545F491UL
+
+simadc_wave_t simadc_waves[8] = {
+  {2248, 120, 40, 128, 6},  // current A, 200 counts above the reference.
+  {2600, 40, 40, 128, 4},   // voltage A.
+  {1848, 60, 25, 64, 6},    // current B, 200 counts below.
+  {2500, 20, 25, 64, 4},    // voltage B.
+  {2048, 0, 1, 0, 2},       // VREF bidirectional.
+  {40, 0, 1, 0, 2},         // VREF unidirectional.
+  {4000, 0, 1, 0, 2},       // VREF33.
+  {1000, 0, 1, 0, 0},       // CH8.
+};
+
+static uint16_t simadc_phase[8];
+static uint32_t simadc_noise = SIMADC_SEED;
+
+void simadc_reset(void) {
+  memset(simadc_phase, 0, sizeof(simadc_phase));
+  simadc_noise = SIMADC_SEED;
+}
+
+void ICACHE_RAM_ATTR simadc_read_burst(uint16_t values[8], uint8_t mask) {
+  for (uint8_t i = 0; i < 8; i++) {
+    if (!(mask & (1 << i))) continue;
+    const simadc_wave_t &w = simadc_waves[i];
+    int32_t v = w.level - w.ripple / 2;
+    if (w.ripple && w.period) {
+      if (((uint32_t)simadc_phase[i] << 8) < (uint32_t)w.duty * w.period) v += w.ripple;
+      if (++simadc_phase[i] >= w.period) simadc_phase[i] = 0;
+    }
+    if (w.noise) {
+      simadc_noise = simadc_noise * 1664525UL + 1013904223UL;
+      v += (int32_t)(((simadc_noise >> 16) * (w.noise + 1)) >> 16) - w.noise / 2;
+    }
+    if (v < 0) v = 0;
+    if (v > 4095) v = 4095;
+    values[i] = v;
+  }
+}
+
+#endif // EMONDC_SIM_ADC
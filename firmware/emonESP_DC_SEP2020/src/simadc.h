@@ -0,0 +1,34 @@
+// emonDC simulated MCP3208, free to use and modify.
+
+#ifndef _EMONDC_SIMADC_H
+#define _EMONDC_SIMADC_H
+
+#include <Arduino.h>
+
+// Build with -D EMONDC_SIM_ADC (the emonesp-dc-sim environment) and the
+// sampler reads these waveforms in place of the MCP3208, so the whole chain
+// from the ISR through the filters, calibration, energy, SD and the network
+// sinks can be timed on a bare board with the same input every run.
+// Each channel is a DC level, a square wave ripple (PWM charge controller)
+// and pseudo random noise from a fixed seed.
+
+struct simadc_wave_t {
+  uint16_t level;      // counts.
+  uint16_t ripple;     // peak to peak counts, 0 for none.
+  uint16_t period;     // ripple period in passes of that channel.
+  uint8_t duty;        // ripple high time, /256.
+  uint8_t noise;       // peak to peak counts.
+};
+
+// the clock is set to this at boot, 2020-09-01 00:00 UTC.
+#define SIMADC_EPOCH 1598918400
+
+// Current, voltage, current, voltage, VREF bi, VREF uni, VREF33, CH8.
+extern simadc_wave_t simadc_waves[8];
+
+// Start the waveforms and the noise again from the beginning.
+void simadc_reset(void);
+// Drop-in for AH_MCP320x::readBurst(), called from the sampling ISR.
+void simadc_read_burst(uint16_t values[8], uint8_t mask);
+
+#endif // _EMONDC_SIMADC_H
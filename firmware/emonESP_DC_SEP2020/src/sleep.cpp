@@ -1,22 +1,219 @@
+// emonDC deep-sleep low power logging, free to use and modify.
+
+// Everything that has to outlive a deep sleep is kept in RTC user memory,
+// checked with a CRC since it holds garbage after a power on: the energy and
+// charge totals, the state of charge, the readings not posted yet and the
+// measured wake and post times. The totals only reach the flash checkpoints
+// every ENERGY_SAVE_INTERVAL_MS of time awake and asleep, as when running normally.
+// Energy is only measured while awake, the sleep in between is filled in
+// from the average of the wake before it, scaled to the time asleep.
+// The radio is left off for wakes that do not post, chosen when going to
+// sleep, which is most of the saving.
+
 #include "sleep.h"
+#include "emonesp.h"
 #include "emondc.h"
+#include "energy.h"
+#include "checkpoint.h"
+#include "measurement.h"
+#include "sdlog.h"
+#include "replay.h"
+#include "config.h"
+#include "wifi.h"
+#include "emoncms.h"
+#include "mqtt.h"
 
-bool sleep_mode = false;
+bool low_power_mode = false;
+unsigned int waking_time = 6000;
+unsigned int sleeping_time = 10000;
+uint8_t sleep_post_every = 1;
+uint32_t sleep_wakes = 0;
 
-void sleep_check(void) {
-  if (sleep_mode == true) {
+struct sleep_state_t {
+  uint32_t crc;          // of everything after it.
+  uint32_t wakes;
+  uint32_t elapsed_s;    // awake and asleep, for readings without the RTC chip.
+  uint32_t saved_s;      // elapsed_s when the totals last went to flash.
+  uint32_t wake_ms;      // average wake without a post, 0 until measured.
+  uint32_t post_ms;      // average time a post adds.
+  uint8_t batch_count;
+  uint8_t post_next;     // the radio was left on for this wake.
+  uint8_t pad[2];
+  double totals[8];
+  double state_of_charge;
+  Measurement batch[SLEEP_BATCH_MAX];
+};
+
+static_assert(sizeof(sleep_state_t) <= 512, "RTC user memory is 512 bytes");
+
+static sleep_state_t sleep_state;
+static bool sleep_valid = false;
+
+static double *const sleep_totals[8] = {&Wh_chA_positive, &Wh_chA_negative, &Wh_chB_positive, &Wh_chB_negative,
+                                        &Ah_positive_A, &Ah_negative_A, &Ah_positive_B, &Ah_negative_B};
+
+
+static uint32_t sleep_crc(const sleep_state_t &s) {
+  return checkpoint_crc((const uint8_t *)&s + sizeof(s.crc), sizeof(s) - sizeof(s.crc));
+}
+
+void sleep_setup(void) {
+  if (sleep_post_every < 1) sleep_post_every = 1;
+  if (sleep_post_every > SLEEP_BATCH_MAX) sleep_post_every = SLEEP_BATCH_MAX;
+
+  ESP.rtcUserMemoryRead(0, (uint32_t *)&sleep_state, sizeof(sleep_state));
+  sleep_valid = sleep_state.crc == sleep_crc(sleep_state) && sleep_state.batch_count <= SLEEP_BATCH_MAX;
+  if (!sleep_valid) {
+    memset(&sleep_state, 0, sizeof(sleep_state));
+    return;
+  }
+  for (uint8_t i = 0; i < 8; i++) *sleep_totals[i] = sleep_state.totals[i];
+  state_of_charge = sleep_state.state_of_charge;
+  sleep_wakes = sleep_state.wakes;
+}
+
+static void sleep_batch_add(const Measurement &m) {
+  if (sleep_state.batch_count == SLEEP_BATCH_MAX) {
+    // not posted in time, the oldest is still on the SD card.
+    memmove(&sleep_state.batch[0], &sleep_state.batch[1], (SLEEP_BATCH_MAX - 1) * sizeof(Measurement));
+    sleep_state.batch_count--;
+  }
+  sleep_state.batch[sleep_state.batch_count++] = m;
+}
+
+// the radio is up, hand the batch over. False if it could not be.
+static bool sleep_post(void) {
+  unsigned long start = millis();
+  wifi_setup();
+  while (wifi_connecting && millis() - start < SLEEP_POST_TIMEOUT_MS) {
+    wifi_loop();
+    delay(10);
+  }
+  if (WiFi.status() != WL_CONNECTED) return false;
+
+  bool sent = false;
+  if (emoncms_apikey != 0) {
+    for (uint8_t i = 0; i < sleep_state.batch_count; i++) emoncms_publish_measurement(sleep_state.batch[i]);
+    while (emoncms_queued() > 0 && millis() - start < SLEEP_POST_TIMEOUT_MS) {
+      emoncms_loop();
+      delay(10);
+    }
+    sent = emoncms_queued() == 0;
+  }
+  if (mqtt_server != 0) {
+    mqtt_loop(); // connects.
+    if (mqtt_connected()) {
+      for (uint8_t i = 0; i < sleep_state.batch_count; i++) mqtt_publish_measurement(sleep_state.batch[i]);
+      mqtt_loop();
+      sent = true;
+    }
+  }
+  return sent;
+}
 
+// Keep the state and sleep, the next wake posts when it is due or the batch is full.
+static void sleep_now(void) {
+  sleep_state.wakes = ++sleep_wakes;
+  sleep_state.elapsed_s += (millis() + sleeping_time + 500) / 1000;
+  for (uint8_t i = 0; i < 8; i++) sleep_state.totals[i] = *sleep_totals[i];
+  sleep_state.state_of_charge = state_of_charge;
+
+  if (sleep_state.elapsed_s - sleep_state.saved_s >= ENERGY_SAVE_INTERVAL_MS / 1000) {
+    energy_save();
+    sleep_state.saved_s = sleep_state.elapsed_s;
   }
+  if (SD_present) sdlog_close(); // staged log rows to the card.
+  if (SD_present) replay_save();
+
+  sleep_state.post_next = (sleep_wakes % sleep_post_every == 0) || sleep_state.batch_count >= SLEEP_BATCH_MAX - 1;
+  sleep_state.crc = sleep_crc(sleep_state);
+  ESP.rtcUserMemoryWrite(0, (uint32_t *)&sleep_state, sizeof(sleep_state));
+
+  Serial.print("sleeping ms:"); Serial.print(sleeping_time); Serial.print(" post next wake:"); Serial.println(sleep_state.post_next);
+  ESP.deepSleep((uint64_t)sleeping_time * 1000, sleep_state.post_next ? WAKE_RF_DEFAULT : WAKE_RF_DISABLED);
 }
 
+static uint32_t sleep_average_in(uint32_t average, uint32_t x) {
+  return average ? (3 * average + x) / 4 : x;
+}
+
+
+//-------------------------
+// Timer wake
+//-------------------------
 void wake_from_sleep(void) {
-  // wake from sleep
   Serial.println("I'm awake!");
+  bool posting = sleep_valid && sleep_state.post_next;
+  if (!posting) {
+    WiFi.mode(WIFI_OFF);
+    WiFi.forceSleepBegin();
+  }
+
+  // one reading over the whole wake.
+  readings_interval = max(1U, waking_time / 1000);
+  main_interval_seconds = readings_interval;
   emondc_setup();
-  while (1) {
+
+  double before[8];
+  for (uint8_t i = 0; i < 8; i++) before[i] = *sleep_totals[i];
+  double soc_before = state_of_charge;
+
+  unsigned long start = millis();
+  measurement_pending = false;
+  while (!measurement_pending && millis() - start < 2UL * readings_interval * 1000 + 1000) {
     emondc_loop();
-    // if (averaging_loop_counter >= 100 || digitalRead(0) == LOW) {
-    //post to emonCMS.
-    //}
+    yield();
+  }
+  unsigned long sampled_ms = millis() - start;
+  if (measurement_pending) {
+    Measurement m = last_measurement;
+    if (!m.rtc_time) m.time = sleep_state.elapsed_s + millis() / 1000;
+    sleep_batch_add(m);
   }
+
+  unsigned long sampled_end = millis();
+  if (posting) {
+    if (sleep_post()) sleep_state.batch_count = 0;
+    sleep_state.post_ms = sleep_average_in(sleep_state.post_ms, millis() - sampled_end);
+  } else {
+    sleep_state.wake_ms = sleep_average_in(sleep_state.wake_ms, millis());
+  }
+
+  // fill in the time not sampled, wake overheads and the sleep to come, at this wake's average.
+  if (measurement_pending && sampled_ms > 0) {
+    double scale = (double)(millis() - sampled_ms + sleeping_time) / sampled_ms;
+    for (uint8_t i = 0; i < 8; i++) *sleep_totals[i] += (*sleep_totals[i] - before[i]) * scale;
+    state_of_charge += (state_of_charge - soc_before) * scale;
+    if (state_of_charge > 1.0) state_of_charge = 1.0;
+    if (state_of_charge < 0.0) state_of_charge = 0.0;
+  }
+  sleep_now();
+}
+
+
+//-------------------------
+// From normal running
+//-------------------------
+void sleep_check(void) {
+  if (!low_power_mode || millis() < SLEEP_SETUP_WINDOW_MS) return;
+  Serial.println("low power mode, going to sleep.");
+  if (!sleep_valid) {
+    memset(&sleep_state, 0, sizeof(sleep_state));
+    sleep_wakes = 0;
+    sleep_valid = true;
+  }
+  sleep_state.batch_count = 0; // posted while running normally.
+  energy_save();
+  sleep_state.saved_s = sleep_state.elapsed_s + (millis() + sleeping_time + 500) / 1000; // as sleep_now() will count it.
+  sleep_now();
+}
+
+double sleep_average_ma(void) {
+  double wake_ms = sleep_state.wake_ms ? sleep_state.wake_ms : waking_time + SLEEP_BOOT_MS_DEFAULT;
+  double post_ms = (sleep_state.post_ms ? sleep_state.post_ms : SLEEP_POST_MS_DEFAULT) / (double)sleep_post_every;
+  double cycle_ms = wake_ms + post_ms + sleeping_time;
+  // radio on for the whole of a posting wake, so its sampling part counts at the radio draw too.
+  double radio_ms = post_ms + wake_ms / sleep_post_every;
+  double mA_ms = SLEEP_AWAKE_MA * (wake_ms - wake_ms / sleep_post_every) + SLEEP_RADIO_MA * radio_ms + SLEEP_ASLEEP_MA * sleeping_time;
+  return mA_ms / cycle_ms;
 }
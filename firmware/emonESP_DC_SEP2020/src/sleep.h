@@ -1,10 +1,58 @@
+// emonDC deep-sleep low power logging, free to use and modify.
+
 #ifndef _DEEPSLEEPDC_H
 #define _DEEPSLEEPDC_H
 
 #include <Arduino.h>
 
-void sleep_check(void);
+// In low power mode the unit wakes on a timer, takes one reading over
+// waking_time, logs it to the SD card and keeps it in RTC memory, then deep
+// sleeps for sleeping_time. Every sleep_post_every wakes the radio comes up
+// and the kept readings are posted. Deep sleep needs GPIO16 tied to RST.
+//
+// After a power on or a reset it runs normally for SLEEP_SETUP_WINDOW_MS
+// first, so the web pages can be reached to change the settings.
+#ifndef SLEEP_SETUP_WINDOW_MS
+#define SLEEP_SETUP_WINDOW_MS 600000UL
+#endif
+// readings kept in RTC memory between posts, it holds 512 bytes.
+#define SLEEP_BATCH_MAX       3
+// give up on the network after this long awake, and sleep anyway.
+#define SLEEP_POST_TIMEOUT_MS 20000UL
+
+// Board draw for the average current estimate, mA. Awake with the radio
+// off (ADC, SD card, amplifiers), with the radio on, and asleep (regulator,
+// amplifiers and RTC, the ESP8266 itself is around 0.02 mA).
+#ifndef SLEEP_AWAKE_MA
+#define SLEEP_AWAKE_MA  30.0
+#endif
+#ifndef SLEEP_RADIO_MA
+#define SLEEP_RADIO_MA  80.0
+#endif
+#ifndef SLEEP_ASLEEP_MA
+#define SLEEP_ASLEEP_MA 1.0
+#endif
+// until measured, the time a wake takes on top of waking_time, and to post.
+#define SLEEP_BOOT_MS_DEFAULT 600
+#define SLEEP_POST_MS_DEFAULT 6000
+
+extern bool low_power_mode;
+extern unsigned int waking_time;    // ms sampling per wake.
+extern unsigned int sleeping_time;  // ms asleep.
+extern uint8_t sleep_post_every;    // wakes per post, 1 to SLEEP_BATCH_MAX.
+extern uint32_t sleep_wakes;        // since low power mode began.
 
+// Restore the totals kept in RTC memory, they are newer than the flash copy.
+// Call after the config is loaded.
+void sleep_setup(void);
+
+// A timer wake: sample, keep the reading, post when due and sleep again. Does not return.
 void wake_from_sleep(void);
 
+// From normal running, go to sleep once the setup window is over.
+void sleep_check(void);
+
+// Average draw in mA for the settings, from measured wake and post times once there are some.
+double sleep_average_ma(void);
+
 #endif // _DEEPSLEEPDC_H
@@ -43,8 +43,37 @@
 #include "emoncms.h"
 #include "mqtt.h"
 #include "emondc.h" // emonDC additions.
+#include "measurement.h"
 #include "gpio0.h" // button pressing.
 #include "sleep.h" // deep-sleep mode management.
+#include "checkpoint.h" // energy and state of charge kept through restarts.
+
+unsigned long boot_sample_ms = 0;
+unsigned long boot_wifi_ms = 0;
+unsigned long boot_post_ms = 0;
+
+// Network services are started from loop(), one a pass, once sampling runs.
+#define NETWORK_STAGES 3
+static uint8_t network_stage = 0;
+
+static void network_start_loop() {
+  switch (network_stage) {
+  case 0:
+    // Initialise the WiFi, associating carries on in wifi_loop().
+    wifi_setup();
+    break;
+  case 1:
+    // Bring up the web server
+    web_server_setup();
+    break;
+  case 2:
+    // Start the OTA update systems
+    ota_setup();
+    DEBUG.println("Server started");
+    break;
+  }
+  network_stage++;
+}
 
 
 // -------------------------------------------------------------------
@@ -62,24 +91,21 @@ void setup() {
   DEBUG.print("Reset cause: ");
   DEBUG.println(ESP.getResetReason());
 
-  // Deep sleep wake-up routine (for a low-power-mode idea).
-  if (ESP.getResetReason() == "Deep-Sleep Wake") {
-    // wake_from_sleep();
-  }
-  else {
-    // Read saved settings from the config
-    config_load_settings();
-    // Initialise the WiFi
-    wifi_setup();
-    // Bring up the web server
-    web_server_setup();
-    // Start the OTA update systems
-    ota_setup();
-    // emonDC related inits - SD card, RTC etc.
-    emondc_setup();
+  // Read saved settings from the config
+  config_load_settings();
+  // totals from the newest flash checkpoint, newer than the EEPROM copy.
+  checkpoint_setup();
+  // totals kept through deep sleep, newer than the ones in flash.
+  sleep_setup();
 
-    DEBUG.println("Server started");
+  // Deep sleep wake-up routine, samples, posts when due and sleeps again.
+  if (low_power_mode && ESP.getResetReason() == "Deep-Sleep Wake") {
+    wake_from_sleep();
   }
+
+  // emonDC related inits - SD card, RTC, then sampling starts, before the
+  // network so a reboot loses as little data as it can.
+  emondc_setup();
   
 } // end setup
 
@@ -88,30 +114,43 @@ void setup() {
 // LOOP
 // -------------------------------------------------------------------
 void loop() {
-  //ESP.deepSleep(2000000, WAKE_RF_DEFAULT);
-  //Serial.println(millis());
-  //sleep_check();
-  
+  sleep_check(); // low power mode, once the setup window is over.
+
 
-  ota_loop();
-  web_server_loop();
-  wifi_loop();
+  if (network_stage < NETWORK_STAGES) {
+    network_start_loop();
+  } else {
+    ota_loop();
+    web_server_loop();
+    wifi_loop();
+  }
   emondc_loop();
   gpio0_loop();
   
+  // emonDC measurements, posted straight from the record.
+  boolean gotMeasurement = measurement_pending;
+  if (gotMeasurement) {
+    measurement_pending = false;
+    last_datastr = ""; // /lastvalues shows the measurement again.
+  }
+
+  // test API and serial input.
   String input = "";
   boolean gotInput = input_get(input);
+  if (gotMeasurement || gotInput) web_server_push_values(); // to WebSocket clients.
 
   if (wifi_mode == WIFI_MODE_STA || wifi_mode == WIFI_MODE_AP_AND_STA) {
-    if (emoncms_apikey != 0 && gotInput) {
-      emoncms_publish(input);
+    // queued while associating, sent once connected.
+    if (emoncms_apikey != 0) {
+      if (gotMeasurement) emoncms_publish_measurement(last_measurement);
+      if (gotInput) emoncms_publish(input.c_str());
+      if (!wifi_connecting) emoncms_loop();
     }
-    if (mqtt_server != 0)
+    if (mqtt_server != 0 && !wifi_connecting)
     {
       mqtt_loop();
-      if (gotInput) {
-        mqtt_publish(input);
-      }
+      if (gotMeasurement) mqtt_publish_measurement(last_measurement);
+      if (gotInput) mqtt_publish(input.c_str());
     }
   }
   yield();
@@ -0,0 +1,151 @@
+// emonDC high rate sample stream, free to use and modify.
+
+// Samples are taken from emondc_loop as it drains the sampler, so the stream
+// runs at the sampling rate, less any decimation, and never holds up the
+// averaging. Two frames are filled in turn, one can be waiting to be sent
+// while the other fills. If the client still has not taken the waiting one when
+// the next fills, the new frame is dropped and counted. Each stream times out,
+// so a forgotten browser tab can't keep the WiFi busy.
+
+#include "stream.h"
+#include "sampler.h"
+#include "web_server.h"
+#include "debug.h"
+
+#define STREAM_CHANNELS 8
+
+static bool stream_on = false;
+static uint32_t stream_client_id = 0;
+static uint8_t stream_channels = 0;
+static uint8_t stream_channel_count = 0;
+static uint8_t stream_decimate = 1;
+static uint16_t stream_points_max = 0;
+static unsigned long stream_startedMillis = 0;
+static unsigned long stream_duration_ms = 0;
+
+static uint8_t stream_frames[2][sizeof(stream_frame_header_t) + STREAM_FRAME_BYTES];
+static uint8_t stream_filling = 0;      // frame being filled.
+static bool stream_waiting = false;     // the other frame is full and not sent yet.
+static uint16_t stream_points = 0;      // in the frame being filled.
+static uint8_t stream_summed = 0;       // samples in the point being summed.
+static uint16_t stream_sum[STREAM_CHANNELS];
+static uint32_t stream_sequence = 0;
+static uint32_t stream_dropped = 0;
+
+static void stream_notify(const String &msg) {
+  AsyncWebSocketClient *client = ws.client(stream_client_id);
+  if (client) client->text(msg);
+}
+
+void stream_start(uint32_t client_id, uint8_t channels, uint8_t decimate, uint16_t seconds) {
+  if (channels == 0) channels = 0x0F; // A and B current and voltage.
+  if (decimate == 0) decimate = 1;
+  if (decimate > STREAM_MAX_DECIMATE) decimate = STREAM_MAX_DECIMATE;
+  if (seconds == 0) seconds = STREAM_DEFAULT_SECONDS;
+  if (seconds > STREAM_MAX_SECONDS) seconds = STREAM_MAX_SECONDS;
+
+  // the same request again only extends the time.
+  bool same = stream_on && client_id == stream_client_id && channels == stream_channels && decimate == stream_decimate;
+  stream_client_id = client_id;
+  stream_startedMillis = millis();
+  stream_duration_ms = seconds * 1000UL;
+  if (!same) {
+    stream_channels = channels;
+    stream_channel_count = 0;
+    for (uint8_t ch = 0; ch < STREAM_CHANNELS; ch++) {
+      if (channels & (1 << ch)) stream_channel_count++;
+    }
+    stream_decimate = decimate;
+    stream_points_max = STREAM_FRAME_BYTES / (stream_channel_count * sizeof(uint16_t));
+    stream_filling = 0;
+    stream_waiting = false;
+    stream_points = 0;
+    stream_summed = 0;
+    memset(stream_sum, 0, sizeof(stream_sum));
+    stream_sequence = 0;
+    stream_dropped = 0;
+    stream_on = true;
+  }
+  DBUGF("stream %u: channels %02x decimate %u for %us", client_id, channels, decimate, seconds);
+
+  stream_notify("{\"stream\":{\"channels\":" + String(stream_channels) + ",\"decimate\":" + String(stream_decimate)
+                + ",\"seconds\":" + String(seconds) + ",\"rate\":" + String(sample_rate_hz / stream_decimate) + "}}");
+}
+
+void stream_stop(void) {
+  if (!stream_on) return;
+  stream_on = false;
+  stream_notify("{\"stream\":false}");
+}
+
+bool stream_active(void) {
+  return stream_on;
+}
+
+uint32_t stream_client(void) {
+  return stream_client_id;
+}
+
+void stream_sample(const uint16_t *readings) {
+  if (!stream_on) return;
+  for (uint8_t ch = 0; ch < STREAM_CHANNELS; ch++) {
+    if (stream_channels & (1 << ch)) stream_sum[ch] += readings[ch];
+  }
+  if (++stream_summed < stream_decimate) return;
+
+  uint16_t *point = (uint16_t *)(stream_frames[stream_filling] + sizeof(stream_frame_header_t))
+                    + stream_points * stream_channel_count;
+  for (uint8_t ch = 0; ch < STREAM_CHANNELS; ch++) {
+    if (stream_channels & (1 << ch)) *point++ = stream_sum[ch];
+  }
+  memset(stream_sum, 0, sizeof(stream_sum));
+  stream_summed = 0;
+  if (++stream_points < stream_points_max) return;
+
+  stream_frame_header_t *header = (stream_frame_header_t *)stream_frames[stream_filling];
+  header->sequence = stream_sequence++;
+  header->rate_hz = sample_rate_hz / stream_decimate;
+  header->channels = stream_channels;
+  header->decimate = stream_decimate;
+  header->points = stream_points;
+  header->reserved = 0;
+  stream_points = 0;
+  if (stream_waiting) {
+    stream_dropped++; // the client is behind, refill this one.
+    return;
+  }
+  stream_waiting = true;
+  stream_filling ^= 1;
+}
+
+void stream_loop(void) {
+  if (!stream_on) return;
+  if (millis() - stream_startedMillis >= stream_duration_ms) {
+    stream_stop();
+    return;
+  }
+  AsyncWebSocketClient *client = ws.client(stream_client_id);
+  if (!client) {
+    stream_on = false;
+    return;
+  }
+  if (!stream_waiting || !client->canSend()) return;
+
+  uint8_t *frame = stream_frames[stream_filling ^ 1];
+  stream_waiting = false;
+  if (ESP.getFreeHeap() < STREAM_MIN_FREE_HEAP) {
+    stream_dropped++;
+    return;
+  }
+  stream_frame_header_t *header = (stream_frame_header_t *)frame;
+  header->dropped = stream_dropped;
+  header->overruns = sampler_overruns;
+  size_t len = sizeof(stream_frame_header_t) + header->points * stream_channel_count * sizeof(uint16_t);
+  AsyncWebSocketMessageBuffer *buffer = ws.makeBuffer(len);
+  if (!buffer) {
+    stream_dropped++;
+    return;
+  }
+  memcpy(buffer->get(), frame, len);
+  client->binary(buffer);
+}
@@ -0,0 +1,48 @@
+// emonDC high rate sample stream, free to use and modify.
+
+#ifndef _EMONDC_STREAM_H
+#define _EMONDC_STREAM_H
+
+#include <Arduino.h>
+
+// A WebSocket client starts a stream with the text message
+//   {"stream":{"channels":15,"decimate":1,"seconds":30}}
+// channels is a bit mask of ADC channels (bit 0 is channel A current), decimate
+// the number of samples summed into each point (1 to 16) and seconds how long
+// to run for, sending it again restarts the time. {"stream":false} stops it, as
+// does the client going away. The reply {"stream":{...,"rate":points per second}}
+// confirms the settings, and {"stream":false} is sent when it ends.
+// Points come back as binary frames, a stream_frame_header_t then `points`
+// sets of one uint16 per channel, lowest channel first, raw ADC counts summed
+// over `decimate` samples.
+
+#ifndef STREAM_FRAME_BYTES
+#define STREAM_FRAME_BYTES 1024 // points per frame, as bytes.
+#endif
+#define STREAM_DEFAULT_SECONDS 30
+#define STREAM_MAX_SECONDS     300
+#define STREAM_MAX_DECIMATE    16   // 16 x 4095 still fits a uint16.
+// frames are dropped rather than sent when free heap is below this.
+#define STREAM_MIN_FREE_HEAP   12000
+
+struct stream_frame_header_t {
+  uint32_t sequence;  // frames since the stream started, including dropped ones.
+  uint32_t dropped;   // frames not sent because the client or heap could not keep up.
+  uint32_t overruns;  // sampler_overruns, samples lost before they reached the stream.
+  uint16_t rate_hz;   // points per second.
+  uint8_t channels;
+  uint8_t decimate;
+  uint16_t points;
+  uint16_t reserved;
+};
+
+void stream_start(uint32_t client_id, uint8_t channels, uint8_t decimate, uint16_t seconds);
+void stream_stop(void);
+bool stream_active(void);
+uint32_t stream_client(void);
+// Add one raw sample set, call for every sample taken.
+void stream_sample(const uint16_t *readings);
+// Send filled frames and end the stream when its time is up.
+void stream_loop(void);
+
+#endif // _EMONDC_STREAM_H
@@ -44,6 +44,19 @@
 #include "ota.h"
 #include "debug.h"
 #include "emondc.h"
+#include "sampler.h"
+#include "sdlog.h"
+#include "replay.h"
+#include "stream.h"
+#include "capture.h"
+#include "oversample.h"
+#include "filter.h"
+#include "autozero.h"
+#include "sleep.h"
+#include "calibration.h"
+#include "battery.h"
+#include "checkpoint.h"
+#include "measurement.h"
 
 #include "./web_server_files/web_server.config_js.h"
 #include "./web_server_files/web_server.home_html.h"
@@ -271,11 +284,12 @@ handleSaveMqtt(AsyncWebServerRequest *request) {
                    request->arg("topic"),
                    request->arg("prefix"),
                    request->arg("user"),
-                   request->arg("pass"));
+                   request->arg("pass"),
+                   request->arg("json") == "1");
 
   char tmpStr[200];
-  snprintf(tmpStr, sizeof(tmpStr), "Saved: %s %s %s %s %s", mqtt_server.c_str(),
-           mqtt_topic.c_str(), mqtt_feed_prefix.c_str(), mqtt_user.c_str(), mqtt_pass.c_str());
+  snprintf(tmpStr, sizeof(tmpStr), "Saved: %s %s %s %s %s %d", mqtt_server.c_str(),
+           mqtt_topic.c_str(), mqtt_feed_prefix.c_str(), mqtt_user.c_str(), mqtt_pass.c_str(), mqtt_json_mode);
   DBUGLN(tmpStr);
 
   response->setCode(200);
@@ -286,6 +300,28 @@ handleSaveMqtt(AsyncWebServerRequest *request) {
   mqttRestartTime = millis();
 }
 
+// -------------------------------------------------------------------
+// Save the waveform capture triggers
+// url: /savecapture
+// -------------------------------------------------------------------
+void handleSaveCapture(AsyncWebServerRequest *request) {
+  AsyncResponseStream *response;
+  if (false == requestPreProcess(request, response, "text/plain")) {
+    return;
+  }
+
+  config_save_capture(request->arg("current").toFloat(),
+                      request->arg("voltage").toFloat(),
+                      request->arg("dvdt").toFloat());
+
+  char tmpStr[80];
+  snprintf(tmpStr, sizeof(tmpStr), "Saved: %.3f %.3f %.3f", capture_current_max, capture_voltage_min, capture_dvdt);
+  DBUGLN(tmpStr);
+
+  response->setCode(200);
+  response->print(tmpStr);
+  request->send(response);
+}
 
 // -------------------------------------------------------------------
 // Save the web site user/pass
@@ -345,19 +381,136 @@ void handleEmonDC(AsyncWebServerRequest *request) {
   String qBattVoltsAlarmLow = request->arg("BattVoltsAlarmLow");
   String qBattPeukert = request->arg("BattPeukert");
   String qBattTempCo = request->arg("BattTempCo");
+  String qsample_rate = request->arg("sampleRate");
+  String qoversample_A = request->arg("oversampleA");
+  String qoversample_B = request->arg("oversampleB");
+  String qoversample_filter = request->arg("oversampleFilter");
+  String qschedule = request->arg("schedule");
+  String qfilters = request->arg("filters");
+  String qfilter_iir_shift = request->arg("filterIirShift");
+  String qfilter_notch_hz = request->arg("filterNotchHz");
+  String qautozero = request->arg("autozero");
+  String qautozero_idle_amps = request->arg("autozeroIdleAmps");
+  String qlow_power = request->arg("lowPower");
+  String qwaking_time = request->arg("wakingTime");
+  String qsleeping_time = request->arg("sleepingTime");
+  String qsleep_post_every = request->arg("sleepPostEvery");
 
   config_save_emondc(qinterval, qicalA, qvcalA, qicalB, qvcalB, 
   qchanA_VrefSet, qchanB_VrefSet, qchannelA_gain, qchannelB_gain, 
   qR1_A, qR2_A, qR1_B, qR2_B, qRshunt_A, qRshunt_B,
   qAmpOffset_A, qAmpOffset_B, qVoltOffset_A, qVoltOffset_B,
   qBattType,qBattCapacity,qBattCapHr,qBattNom,qBattVoltsAlarmHigh,qBattVoltsAlarmLow,
-  qBattPeukert,qBattTempCo);
+  qBattPeukert,qBattTempCo,qsample_rate,qoversample_A,qoversample_B,qoversample_filter,qschedule,
+  qfilters,qfilter_iir_shift,qfilter_notch_hz,qautozero,qautozero_idle_amps,
+  qlow_power,qwaking_time,qsleeping_time,qsleep_post_every);
 
   response->setCode(200);
   response->print("saved");
   request->send(response);
 }
 
+// -------------------------------------------------------------------
+// Zero the offsets from the next few intervals, with nothing connected
+// url: /calibrate/zero?channel=A|B (both if left out)&voltage=1 (voltage inputs shorted too)
+// -------------------------------------------------------------------
+void handleCalibrateZero(AsyncWebServerRequest *request) {
+  AsyncResponseStream *response;
+  if (false == requestPreProcess(request, response, "text/plain")) {
+    return;
+  }
+
+  String channel = request->arg("channel");
+  uint8_t mask = channel == "A" ? 0x01 : (channel == "B" ? 0x02 : 0x03);
+  autozero_command(mask, request->arg("voltage") == "1");
+
+  response->setCode(200);
+  response->print("zeroing over the next " + String(AUTOZERO_COMMAND_INTERVALS) + " intervals");
+  request->send(response);
+}
+
+// -------------------------------------------------------------------
+// Calibration points, from the last interval against a reference meter
+// url: /calibrate/point?channel=IA|VA|IB|VB&value=<amps or volts read by the meter>
+//      /calibrate/point?channel=IA|VA|IB|VB&clear=1
+// -------------------------------------------------------------------
+static const char *calPointNames[CAL_POINT_CHANNELS] = {"IA", "VA", "IB", "VB"};
+
+void handleCalibratePoint(AsyncWebServerRequest *request) {
+  AsyncResponseStream *response;
+  if (false == requestPreProcess(request, response, "text/plain")) {
+    return;
+  }
+
+  String name = request->arg("channel");
+  int8_t channel = -1;
+  for (uint8_t c = 0; c < CAL_POINT_CHANNELS; c++) {
+    if (name == calPointNames[c]) channel = c;
+  }
+  if (channel < 0) {
+    response->setCode(400);
+    response->print("channel must be IA, VA, IB or VB");
+    request->send(response);
+    return;
+  }
+
+  if (request->arg("clear") == "1") {
+    calibration_clear_points(channel);
+    response->setCode(200);
+    response->print("cleared");
+  } else if (request->hasArg("value")) {
+    const int32_t averaged[CAL_POINT_CHANNELS] = {CH_A_CURRENT_AVERAGED, CH_A_VOLTAGE_AVERAGED,
+                                                 CH_B_CURRENT_AVERAGED, CH_B_VOLTAGE_AVERAGED};
+    int8_t n = calibration_add_point(channel, averaged[channel], lround(request->arg("value").toFloat() * 1e6));
+    if (n < 0) {
+      response->setCode(400);
+      response->print("no room, clear the channel first");
+      request->send(response);
+      return;
+    }
+    response->setCode(200);
+    response->print(String(n) + " points");
+  } else {
+    response->setCode(400);
+    response->print("no value");
+    request->send(response);
+    return;
+  }
+  config_save_calpoints();
+  request->send(response);
+}
+
+// -------------------------------------------------------------------
+// Calibration points in use, counts and the correction in amps or volts
+// url: /calibrate/points
+// -------------------------------------------------------------------
+void handleCalibratePoints(AsyncWebServerRequest *request) {
+  AsyncResponseStream *response;
+  if (false == requestPreProcess(request, response)) {
+    return;
+  }
+
+  response->setCode(200);
+  response->print("[");
+  bool first = true;
+  for (uint8_t c = 0; c < CAL_POINT_CHANNELS; c++) {
+    for (uint8_t i = 0; i < cal_point_count[c]; i++) {
+      if (!first) response->print(",");
+      response->printf("{\"channel\":\"%s\",\"counts\":%.2f,\"correction\":%.4f}", calPointNames[c],
+                       cal_points[c][i].counts_q8 / 256.0, cal_points[c][i].correction_u * 1e-6);
+      first = false;
+    }
+  }
+  response->print("]");
+  request->send(response);
+}
+
+// test API or serial input if there has been some since the last measurement.
+static const char *lastValues()
+{
+  return (last_datastr.length() > 0) ? last_datastr.c_str() : measurement_text;
+}
+
 // -------------------------------------------------------------------
 // Last values on atmega serial
 // url: /lastvalues
@@ -369,68 +522,92 @@ void handleLastValues(AsyncWebServerRequest *request) {
   }
 
   response->setCode(200);
-  response->print(last_datastr);
+  response->print(lastValues());
   request->send(response);
 }
 
 
 // -------------------------------------------------------------------
-// Download from SD card.
-// url: /download
+// Stream a binary SD log as CSV, converted a line at a time.
 // -------------------------------------------------------------------
 bool sdGlobalFileInUse = false;
 File sdGlobalFile;
-// https://github.com/me-no-dev/ESPAsyncWebServer/issues/124
-void handleDownload(AsyncWebServerRequest *request) 
-{
-  if(SD_present && !sdGlobalFileInUse)
-  {
-    sdGlobalFile = SD.open(datalogFilename, FILE_READ);
-    if(sdGlobalFile)
-    {
-      Serial.println("Data remaining:" + String(sdGlobalFile.size()));
-      sdGlobalFileInUse = true;
-
-      AsyncWebServerResponse *response = request->beginChunkedResponse("application/octet-stream", 
-        [](uint8_t *buffer, size_t maxLen, size_t index) -> size_t 
-        {
-          uint32_t bytes = 0;
-
-          //File SDReadFile = SD.open(datalogFilename, FILE_READ);
-          if(sdGlobalFile)
-          {
-            sdGlobalFile.seek(index);
-      
-            size_t dataRemaining = sdGlobalFile.size() - sdGlobalFile.position();
 
-            Serial.println("Data remaining:" + String(dataRemaining));
+void sendSdExport(AsyncWebServerRequest *request, String path)
+{
+  if (!SD_present) {
+    request->send(428, "text/plain", "SD card busy or not initialized");
+    return;
+  }
+  if (sdlog_export_busy()) {
+    request->send(429, "text/plain", "Already exporting a file from SD, try again later");
+    return;
+  }
+  if (!path.startsWith("/")) path = "/" + path;
+  if (!sdlog_export_open(path)) {
+    request->send(404, "text/plain", "Path \"" + path + "\" is not a binary log");
+    return;
+  }
 
-            uint32_t readBytes;
+  AsyncWebServerResponse *response = request->beginChunkedResponse("text/csv",
+    [](uint8_t *buffer, size_t maxLen, size_t index) -> size_t
+    {
+      return sdlog_export_read(buffer, maxLen);
+    });
+  request->onDisconnect([]() { sdlog_export_close(); });
+
+  String filename = path.substring(path.lastIndexOf('/') + 1);
+  if (filename.endsWith(".bin")) filename = filename.substring(0, filename.length() - 4);
+  response->addHeader("Content-Disposition", "attachment; filename=" + filename + ".csv");
+  response->addHeader("Access-Control-Allow-Origin", "*");
+  request->send(response);
+}
 
-            //waitSD();
-            if( dataRemaining > 0) {
-              bytes = sdGlobalFile.readBytes((char *)buffer, min(maxLen, dataRemaining));
-            }
-            //leaveSD();
+// -------------------------------------------------------------------
+// Download the undated log from SD card as CSV.
+// url: /download
+// -------------------------------------------------------------------
+void handleDownload(AsyncWebServerRequest *request) 
+{
+  sendSdExport(request, datalogFilename);
+}
 
-            if(0 == bytes) {
-              Serial.println("Download finished");
-              sdGlobalFile.close();
-              sdGlobalFileInUse = false;
-            }
-          }
-          return bytes;
-        });
+// -------------------------------------------------------------------
+// Export a binary log from SD card.
+// url: /sd/export?file=/2020-09-01.bin&format=csv
+// -------------------------------------------------------------------
+void handleSdExport(AsyncWebServerRequest *request)
+{
+  if (www_username != "" && !request->authenticate(www_username.c_str(), www_password.c_str())) {
+    request->requestAuthentication();
+    return;
+  }
+  if (!request->hasArg("file")) {
+    request->send(400, "text/plain", "file parameter required");
+    return;
+  }
+  if (request->hasArg("format") && request->arg("format") != "csv") {
+    request->send(400, "text/plain", "Only format=csv is supported");
+    return;
+  }
+  sendSdExport(request, request->arg("file"));
+}
 
-      response->addHeader("Content-Disposition", "attachment; filename=" + String("datalog.csv"));
-      response->addHeader("Access-Control-Allow-Origin", "*");
-      request->send(response);
-    } else {
-      request->send(500, "text/plain", "Could not open " + datalogFilename);
-    }
-  } else {
-    request->send(500, "text/plain", "SD card busy or not initialized");
+// -------------------------------------------------------------------
+// Time the battery model against the pow() it replaced.
+// url: /battery/bench
+// -------------------------------------------------------------------
+void handleBatteryBench(AsyncWebServerRequest *request)
+{
+  AsyncResponseStream *response;
+  if (false == requestPreProcess(request, response)) {
+    return;
   }
+  battery_bench_t bench = battery_benchmark();
+  response->setCode(200);
+  response->printf("{\"cpu_mhz\":%u,\"fast_cycles\":%u,\"pow_cycles\":%u,\"max_error\":%.2e}",
+                   ESP.getCpuFreqMHz(), bench.fast_cycles, bench.pow_cycles, bench.max_error);
+  request->send(response);
 }
 
 static String formatTime(time_t time)
@@ -452,6 +629,7 @@ void handleSdGet(AsyncWebServerRequest *request) {
 
   if(SD_present)
   {
+    SamplerBusLock busLock;
     String path = request->url().substring(3);
     if(0 == path.length()) {
       const size_t capacity = JSON_OBJECT_SIZE(6) + 128;
@@ -546,6 +724,7 @@ void handleSdGet(AsyncWebServerRequest *request) {
           [](uint8_t *buffer, size_t maxLen, size_t index) -> size_t 
           {
             uint32_t bytes = 0;
+            SamplerBusLock busLock;
 
             sdGlobalFile.seek(index);
       
@@ -579,6 +758,41 @@ void handleSdGet(AsyncWebServerRequest *request) {
   }
 }
 
+// -------------------------------------------------------------------
+// Waveform captures on the SD card, in directory order, each downloads from its url.
+// url: /captures
+// -------------------------------------------------------------------
+void handleCaptures(AsyncWebServerRequest *request) {
+  AsyncResponseStream *response;
+  if (false == requestPreProcess(request, response)) {
+    return;
+  }
+
+  response->setCode(200);
+  response->print("[");
+  if (SD_present) {
+    SamplerBusLock busLock;
+    File dir = SD.open(CAPTURE_DIR);
+    if (dir && dir.isDirectory()) {
+      bool first = true;
+      while (true) {
+        File entry = dir.openNextFile();
+        if (!entry) break;
+        if (entry.isFile()) {
+          if (!first) response->print(",");
+          response->printf("{\"name\":\"%s\",\"url\":\"/sd" CAPTURE_DIR "/%s\",\"size\":%u}",
+                           entry.name(), entry.name(), (unsigned int)entry.size());
+          first = false;
+        }
+        entry.close();
+      }
+    }
+    if (dir) dir.close();
+  }
+  response->print("]");
+  request->send(response);
+}
+
 void handleSdDelete(AsyncWebServerRequest *request) {
   dumpRequest(request);
 
@@ -590,12 +804,15 @@ void handleSdDelete(AsyncWebServerRequest *request) {
 
   if(SD_present)
   {
+    SamplerBusLock busLock;
     String path = request->url().substring(3);
     if(0 == path.length()) {
       request->send(405);
       return;
     }
 
+    sdlog_close(); // the log file may be the one going, it is reopened on the next flush.
+
     // Check if the file is a directory
     File object = SD.open(path);
     if(object) 
@@ -621,8 +838,10 @@ void handleSdPost(AsyncWebServerRequest *request) {
 
 void handleSdPostBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)
 {
+  SamplerBusLock busLock;
   if(!index) {
     DBUGF("BodyStart: %u", total);
+    sdlog_close(); // in case the upload replaces the open log file.
 
     dumpRequest(request);
 
@@ -686,58 +905,152 @@ void handleSdPostBody(AsyncWebServerRequest *request, uint8_t *data, size_t len,
 
 
 // -------------------------------------------------------------------
-// Returns status json
-// url: /status
+// Status fields, for /status and the WebSocket push.
+// With hashes given, a field is only added when its value has changed
+// since the last time those hashes were used. There is a hash per field,
+// statusFields of them, counted from buildStatus() itself, so a new field
+// needs nothing else.
 // -------------------------------------------------------------------
-void handleStatus(AsyncWebServerRequest *request) {
-  AsyncResponseStream *response;
-  if (false == requestPreProcess(request, response)) {
-    return;
+static uint8_t statusFields = 0;
+
+static void statusField(String &s, uint32_t *hashes, uint8_t &field, const char *key, const String &value, bool quoted = true)
+{
+  if (hashes && field < statusFields) {
+    uint32_t hash = 2166136261UL; // FNV-1a
+    for (unsigned int c = 0; c < value.length(); c++) hash = (hash ^ (uint8_t)value[c]) * 16777619UL;
+    if (hashes[field] == hash) {
+      field++;
+      return;
+    }
+    hashes[field] = hash;
   }
+  field++;
+  if (s.length() > 1) s += ",";
+  s += "\"";
+  s += key;
+  s += quoted ? "\":\"" : "\":";
+  s += value;
+  if (quoted) s += "\"";
+}
 
-  String s = "{";
+// Returns the number of fields, sent or not.
+static uint8_t buildStatus(String &s, uint32_t *hashes)
+{
+  uint8_t field = 0;
+  s = "{";
+  String mode = "";
   if (wifi_mode == WIFI_MODE_STA) {
-    s += "\"mode\":\"STA\",";
+    mode = "STA";
   } else if (wifi_mode == WIFI_MODE_AP_STA_RETRY
              || wifi_mode == WIFI_MODE_AP_ONLY) {
-    s += "\"mode\":\"AP\",";
+    mode = "AP";
   } else if (wifi_mode == WIFI_MODE_AP_AND_STA) {
-    s += "\"mode\":\"STA+AP\",";
+    mode = "STA+AP";
+  }
+  if (mode.length() > 0) statusField(s, hashes, field, "mode", mode);
+  else field++;
+  statusField(s, hashes, field, "networks", "[" + st + "]", false);
+  statusField(s, hashes, field, "rssi", "[" + rssi + "]", false);
+
+  statusField(s, hashes, field, "srssi", String(WiFi.RSSI()));
+  statusField(s, hashes, field, "ipaddress", ipaddress);
+  statusField(s, hashes, field, "emoncms_connected", String(emoncms_connected));
+  statusField(s, hashes, field, "packets_sent", String(packets_sent));
+  statusField(s, hashes, field, "packets_success", String(packets_success));
+  statusField(s, hashes, field, "emoncms_queued", String(emoncms_queued()));
+  statusField(s, hashes, field, "emoncms_dropped", String(emoncms_dropped));
+  statusField(s, hashes, field, "replay_from", String(replay_from));
+  statusField(s, hashes, field, "replay_until", String(replay_until));
+  statusField(s, hashes, field, "replay_rows_sent", String(replay_rows_sent));
+  statusField(s, hashes, field, "replay_held", String(replay_held()));
+
+  statusField(s, hashes, field, "mqtt_connected", String(mqtt_connected()));
+
+  statusField(s, hashes, field, "free_heap", String(ESP.getFreeHeap()));
+  statusField(s, hashes, field, "heap_min", String(loop_heap_min));
+  statusField(s, hashes, field, "samples_hz", String(loop_samples_hz, 1));
+  statusField(s, hashes, field, "sample_cycles", String(loop_sample_cycles));
+  statusField(s, hashes, field, "cpu_mhz", String(ESP.getCpuFreqMHz())); // cycles per us.
+  statusField(s, hashes, field, "interval_us", String(loop_interval_us));
+  statusField(s, hashes, field, "interval_us_max", String(loop_interval_us_max));
+  statusField(s, hashes, field, "heap_frag", String(ESP.getHeapFragmentation()));
+  statusField(s, hashes, field, "max_free_block", String(ESP.getMaxFreeBlockSize()));
+  statusField(s, hashes, field, "sample_rate", String(sample_rate_hz));
+  statusField(s, hashes, field, "sampler_overruns", String(sampler_overruns));
+  statusField(s, hashes, field, "sampler_cycles", String(sampler_cycles)); // per ISR pass.
+  statusField(s, hashes, field, "sampler_cycles_max", String(sampler_cycles_max));
+  // ms from reset, 0 until it happens.
+  statusField(s, hashes, field, "boot_sample_ms", String(boot_sample_ms));
+  statusField(s, hashes, field, "boot_wifi_ms", String(boot_wifi_ms));
+  statusField(s, hashes, field, "boot_post_ms", String(boot_post_ms));
+  // low power mode, the estimate follows the settings.
+  statusField(s, hashes, field, "sleep_avg_ma", String(sleep_average_ma(), 2));
+  statusField(s, hashes, field, "sleep_wakes", String(sleep_wakes));
+  statusField(s, hashes, field, "sampler_underruns", String(sampler_underruns));
+  statusField(s, hashes, field, "sd_flush_us", String(sdlog_flush_us));
+  statusField(s, hashes, field, "sd_flush_us_max", String(sdlog_flush_us_max));
+  statusField(s, hashes, field, "sd_buffered_rows", String(sdlog_buffered_rows()));
+  statusField(s, hashes, field, "ws_clients", String(ws.count()));
+  statusField(s, hashes, field, "streaming", String(stream_active()));
+  statusField(s, hashes, field, "capture_count", String(capture_count));
+  statusField(s, hashes, field, "filter_cycles", String(filter_cycles));
+  statusField(s, hashes, field, "filter_cycles_max", String(filter_cycles_max));
+  // state of charge estimator, see battery.cpp.
+  statusField(s, hashes, field, "soc", String(state_of_charge * 100, 1));
+  statusField(s, hashes, field, "soc_confidence", String(battery_confidence(battery_state) * 100, 1));
+  statusField(s, hashes, field, "soc_profile", battery_params().profile->name);
+  statusField(s, hashes, field, "soc_fulls", String(battery_state.fulls));
+  statusField(s, hashes, field, "soc_ocv_corrections", String(battery_state.ocv_corrections));
+  statusField(s, hashes, field, "checkpoint_seq", String(checkpoint_sequence));
+  // zero correction in use, amps.
+  statusField(s, hashes, field, "zero_IA", String((cal_channels[CAL_CURRENT_A].offset_u - cal_channels[CAL_CURRENT_A].base_offset_u) * 1e-6, 4));
+  statusField(s, hashes, field, "zero_IB", String((cal_channels[CAL_CURRENT_B].offset_u - cal_channels[CAL_CURRENT_B].base_offset_u) * 1e-6, 4));
+  statusField(s, hashes, field, "zeroing", autozero_busy() ? "true" : "false", false);
+  // per channel noise in LSB and effective bits, A current, A voltage, B current, B voltage.
+  static const char *noise_keys[OVERSAMPLE_CHANNELS] = {"noise_IA", "noise_VA", "noise_IB", "noise_VB"};
+  static const char *enob_keys[OVERSAMPLE_CHANNELS] = {"enob_IA", "enob_VA", "enob_IB", "enob_VB"};
+  for (uint8_t ch = 0; ch < OVERSAMPLE_CHANNELS; ch++) {
+    statusField(s, hashes, field, noise_keys[ch], String(oversample_stats[ch].noise_lsb, 2));
+    statusField(s, hashes, field, enob_keys[ch], String(oversample_stats[ch].enob, 1));
   }
-  s += "\"networks\":[" + st + "],";
-  s += "\"rssi\":[" + rssi + "],";
-
-  s += "\"srssi\":\"" + String(WiFi.RSSI()) + "\",";
-  s += "\"ipaddress\":\"" + ipaddress + "\",";
-  s += "\"emoncms_connected\":\"" + String(emoncms_connected) + "\",";
-  s += "\"packets_sent\":\"" + String(packets_sent) + "\",";
-  s += "\"packets_success\":\"" + String(packets_success) + "\",";
-
-  s += "\"mqtt_connected\":\"" + String(mqtt_connected()) + "\",";
-
-  s += "\"free_heap\":\"" + String(ESP.getFreeHeap()) + "\",";
 
-  s += "\"rtc_set\":" + String(timeConfidence ? "true" : "false");
+  statusField(s, hashes, field, "rtc_set", timeConfidence ? "true" : "false", false);
 
 #ifdef ENABLE_LEGACY_API
-  s += ",\"version\":\"" + currentfirmware + "\"";
-  s += ",\"ssid\":\"" + esid + "\"";
-  //s += ",\"pass\":\""+epass+"\""; security risk: DONT RETURN PASSWORDS
-  s += ",\"emoncms_server\":\"" + emoncms_server + "\"";
-  s += ",\"emoncms_path\":\"" + emoncms_path + "\"";
-  s += ",\"emoncms_node\":\"" + emoncms_node + "\"";
-  //s += ",\"emoncms_apikey\":\""+emoncms_apikey+"\""; security risk: DONT RETURN APIKEY
-  s += ",\"emoncms_fingerprint\":\"" + emoncms_fingerprint + "\"";
-  s += ",\"mqtt_server\":\"" + mqtt_server + "\"";
-  s += ",\"mqtt_topic\":\"" + mqtt_topic + "\"";
-  s += ",\"mqtt_user\":\"" + mqtt_user + "\"";
-  //s += ",\"mqtt_pass\":\""+mqtt_pass+"\""; security risk: DONT RETURN PASSWORDS
-  s += ",\"mqtt_feed_prefix\":\"" + mqtt_feed_prefix + "\"";
-  s += ",\"www_username\":\"" + www_username + "\"";
-  //s += ",\"www_password\":\""+www_password+"\""; security risk: DONT RETURN PASSWORDS
+  statusField(s, hashes, field, "version", currentfirmware);
+  statusField(s, hashes, field, "ssid", esid);
+  //statusField(s, hashes, field, "pass", epass); security risk: DONT RETURN PASSWORDS
+  statusField(s, hashes, field, "emoncms_server", emoncms_server);
+  statusField(s, hashes, field, "emoncms_path", emoncms_path);
+  statusField(s, hashes, field, "emoncms_node", emoncms_node);
+  //statusField(s, hashes, field, "emoncms_apikey", emoncms_apikey); security risk: DONT RETURN APIKEY
+  statusField(s, hashes, field, "emoncms_fingerprint", emoncms_fingerprint);
+  statusField(s, hashes, field, "mqtt_server", mqtt_server);
+  statusField(s, hashes, field, "mqtt_topic", mqtt_topic);
+  statusField(s, hashes, field, "mqtt_user", mqtt_user);
+  //statusField(s, hashes, field, "mqtt_pass", mqtt_pass); security risk: DONT RETURN PASSWORDS
+  statusField(s, hashes, field, "mqtt_feed_prefix", mqtt_feed_prefix);
+  statusField(s, hashes, field, "mqtt_json", String(mqtt_json_mode));
+  statusField(s, hashes, field, "www_username", www_username);
+  //statusField(s, hashes, field, "www_password", www_password); security risk: DONT RETURN PASSWORDS
 
 #endif
   s += "}";
+  return field;
+}
+
+// -------------------------------------------------------------------
+// Returns status json
+// url: /status
+// -------------------------------------------------------------------
+void handleStatus(AsyncWebServerRequest *request) {
+  AsyncResponseStream *response;
+  if (false == requestPreProcess(request, response)) {
+    return;
+  }
+
+  String s;
+  buildStatus(s, NULL);
 
   response->setCode(200);
   response->print(s);
@@ -771,6 +1084,7 @@ handleConfig(AsyncWebServerRequest *request) {
   s += "\"mqtt_topic\":\"" + mqtt_topic + "\",";
   s += "\"mqtt_feed_prefix\":\"" + mqtt_feed_prefix + "\",";
   s += "\"mqtt_user\":\"" + mqtt_user + "\",";
+  s += "\"mqtt_json\":\"" + String(mqtt_json_mode) + "\",";
   //s += "\"mqtt_pass\":\""+mqtt_pass+"\","; security risk: DONT RETURN PASSWORDS
   s += "\"www_username\":\"" + www_username + "\",";
   //s += "\"www_password\":\""+www_password+"\","; security risk: DONT RETURN PASSWORDS
@@ -801,7 +1115,24 @@ handleConfig(AsyncWebServerRequest *request) {
   s += "\"BattVoltsAlarmHigh\":\"" + String(BattVoltsAlarmHigh) + "\",";
   s += "\"BattVoltsAlarmLow\":\"" + String(BattVoltsAlarmLow) + "\",";
   s += "\"BattPeukert\":\"" + String(BattPeukert) + "\",";
-  s += "\"BattTempCo\":\"" + String(BattTempCo) + "\"";
+  s += "\"BattTempCo\":\"" + String(BattTempCo) + "\",";
+  s += "\"capture_current_max\":\"" + String(capture_current_max, 3) + "\",";
+  s += "\"capture_voltage_min\":\"" + String(capture_voltage_min, 3) + "\",";
+  s += "\"capture_dvdt\":\"" + String(capture_dvdt, 3) + "\",";
+  s += "\"sampleRate\":\"" + String(sample_rate_hz) + "\",";
+  s += "\"oversampleA\":\"" + String(oversample_bits_A) + "\",";
+  s += "\"oversampleB\":\"" + String(oversample_bits_B) + "\",";
+  s += "\"oversampleFilter\":\"" + String(oversample_filter) + "\",";
+  s += "\"schedule\":\"" + config_schedule_string() + "\",";
+  s += "\"filters\":\"" + config_filters_string() + "\",";
+  s += "\"filterIirShift\":\"" + String(filter_iir_shift) + "\",";
+  s += "\"filterNotchHz\":\"" + String(filter_notch_hz) + "\",";
+  s += "\"autozero\":\"" + String(autozero_enabled) + "\",";
+  s += "\"autozeroIdleAmps\":\"" + String(autozero_idle_amps, 3) + "\",";
+  s += "\"lowPower\":\"" + String(low_power_mode) + "\",";
+  s += "\"wakingTime\":\"" + String(waking_time) + "\",";
+  s += "\"sleepingTime\":\"" + String(sleeping_time) + "\",";
+  s += "\"sleepPostEvery\":\"" + String(sleep_post_every) + "\"";
   s += "}";
 
   response->setCode(200);
@@ -911,15 +1242,31 @@ handleSetTime(AsyncWebServerRequest *request) {
 // Update firmware
 // url: /update
 // -------------------------------------------------------------------
+static bool update_bus_held = false; // the sampler is held off for the upload in progress.
+
+static void update_bus_release(void) {
+  if (!update_bus_held) return;
+  update_bus_held = false;
+  sampler_bus_release();
+}
+
 void handle_update_progress_cb(AsyncWebServerRequest *request, String filename, size_t index, uint8_t *data, size_t len, bool final) {
   uint32_t free_space = (ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000;
   if (!index) {
     Serial.println("Update");
+    if (!update_bus_held) {
+      sampler_bus_acquire(); // no sampling while flash is written, the device restarts after.
+      update_bus_held = true;
+    }
+    // a dropped upload never reaches final, sampling picks up again here.
+    request->onDisconnect([]() { update_bus_release(); });
     Update.runAsync(true);
     if (!Update.begin(free_space)) {
       Update.printError(Serial);
+      update_bus_release();
     }
   }
+  if (!update_bus_held) return; // Update.begin() failed, the rest of the upload is ignored.
 
   Serial.print(".");
   if (Update.write(data, len) != len) {
@@ -929,9 +1276,11 @@ void handle_update_progress_cb(AsyncWebServerRequest *request, String filename,
   if (final) {
     if (!Update.end(true)) {
       Update.printError(Serial);
+      update_bus_release();
     } else {
       // restartNow = true; //Set flag so main loop can issue restart call
       Serial.println("Update complete");
+      emondc_shutdown();
       delay(1000);
       ESP.reset();
     }
@@ -968,12 +1317,92 @@ void handleNotFound(AsyncWebServerRequest *request)
 }
 
 
+// -------------------------------------------------------------------
+// WebSocket push
+// url: /ws
+// New values and the status fields that changed go to every client as
+// JSON text frames, {"values":"k:v,..."} and {"status":{...}}, so the UI
+// does not have to poll /lastvalues and /status.
+// -------------------------------------------------------------------
+static uint32_t *wsStatusHash = NULL; // statusFields long, from the first push.
+static bool wsResync = true; // next status push has every field.
+static unsigned long wsStatusMillis = 0;
+
+// One shared buffer for all clients, nothing is queued while a client is backed up.
+static bool wsSendAll(const String &msg)
+{
+  if (ws.count() == 0) return true;
+  if (!ws.availableForWriteAll()) return false;
+  AsyncWebSocketMessageBuffer *buffer = ws.makeBuffer(msg.length());
+  if (!buffer) return false;
+  memcpy(buffer->get(), msg.c_str(), msg.length());
+  ws.textAll(buffer);
+  return true;
+}
+
+static void wsValuesMessage(String &msg)
+{
+  const char *values = lastValues();
+  msg.reserve(strlen(values) + 16);
+  msg = "{\"values\":\"";
+  msg += values;
+  msg += "\"}";
+}
+
+void web_server_push_values()
+{
+  if (ws.count() == 0) return;
+  String msg;
+  wsValuesMessage(msg);
+  wsSendAll(msg);
+}
+
+static void wsPushStatus()
+{
+  String status;
+  if (!wsStatusHash) {
+    statusFields = buildStatus(status, NULL);
+    wsStatusHash = new uint32_t[statusFields];
+    wsResync = true;
+  }
+  if (wsResync) memset(wsStatusHash, 0xFF, statusFields * sizeof(uint32_t));
+  buildStatus(status, wsStatusHash);
+  if (status.length() <= 2) return; // nothing changed.
+  String msg;
+  msg.reserve(status.length() + 12);
+  msg = "{\"status\":";
+  msg += status;
+  msg += "}";
+  wsResync = !wsSendAll(msg); // skipped fields are sent again in full.
+}
+
+// Text messages from a client, {"stream":{...}} or {"stream":false}, see stream.h.
+static void wsCommand(AsyncWebSocketClient *client, char *data, size_t len)
+{
+  StaticJsonDocument<192> doc;
+  if (deserializeJson(doc, data, len)) return;
+  JsonVariant stream = doc["stream"];
+  if (stream.is<JsonObject>()) {
+    uint8_t channels = stream["channels"];
+    uint8_t decimate = stream["decimate"];
+    uint16_t seconds = stream["seconds"];
+    stream_start(client->id(), channels, decimate, seconds);
+  }
+  else if (stream.is<bool>()) {
+    stream_stop();
+  }
+}
+
 void onWsEvent(AsyncWebSocket * server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len) {
   if(type == WS_EVT_CONNECT) {
     DBUGF("ws[%s][%u] connect", server->url(), client->id());
-    client->ping();
+    wsResync = true;
+    String msg;
+    wsValuesMessage(msg);
+    client->text(msg);
   } else if(type == WS_EVT_DISCONNECT) {
     DBUGF("ws[%s][%u] disconnect: %u", server->url(), client->id());
+    if (stream_active() && stream_client() == client->id()) stream_stop();
   } else if(type == WS_EVT_ERROR) {
     DBUGF("ws[%s][%u] error(%u): %s", server->url(), client->id(), *((uint16_t*)arg), (char*)data);
   } else if(type == WS_EVT_PONG) {
@@ -985,6 +1414,7 @@ void onWsEvent(AsyncWebSocket * server, AsyncWebSocketClient *client, AwsEventTy
     {
       //the whole message is in a single frame and we got all of it's data
       DBUGF("ws[%s][%u] %s-message[%u]: ", server->url(), client->id(), (info->opcode == WS_TEXT)?"text":"binary", len);
+      if (info->opcode == WS_TEXT) wsCommand(client, (char *)data, len);
     } else {
       // TODO: handle messages that are comprised of multiple frames or the frame is split into multiple packets
     }
@@ -1020,6 +1450,8 @@ web_server_setup()
   server.on("/savenetwork", handleSaveNetwork);
   server.on("/saveemoncms", handleSaveEmoncms);
   server.on("/savemqtt", handleSaveMqtt);
+  server.on("/savecapture", handleSaveCapture);
+  server.on("/captures", handleCaptures);
   server.on("/saveadmin", handleSaveAdmin);
   server.on("/settime", handleSetTime);
 
@@ -1032,8 +1464,13 @@ web_server_setup()
   server.on("/lastvalues", handleLastValues);
 
   server.on("/savedc", handleEmonDC);
+  server.on("/calibrate/zero", handleCalibrateZero);
+  server.on("/calibrate/points", handleCalibratePoints);
+  server.on("/calibrate/point", handleCalibratePoint);
   server.on("/download", handleDownload);
 
+  server.on("/battery/bench", HTTP_GET, handleBatteryBench);
+  server.on("/sd/export", HTTP_GET, handleSdExport); // before /sd*, which would match it too.
   server.on("/sd*", HTTP_GET, handleSdGet);
   server.on("/sd*", HTTP_DELETE, handleSdDelete);
   server.on("/sd*", HTTP_POST, handleSdPost, NULL, handleSdPostBody);
@@ -1060,6 +1497,16 @@ web_server_loop() {
     wifi_restart();
   }
 
+  // High rate sample frames, to the client that asked for them.
+  stream_loop();
+
+  // Push status changes to WebSocket clients, dropping the oldest over the limit.
+  if (millis() - wsStatusMillis >= WS_STATUS_INTERVAL_MS) {
+    wsStatusMillis = millis();
+    ws.cleanupClients(WS_MAX_CLIENTS);
+    if (ws.count() > 0) wsPushStatus();
+  }
+
   // Do we need to restart MQTT?
   if (mqttRestartTime > 0 && millis() > mqttRestartTime) {
     mqttRestartTime = 0;
@@ -1069,6 +1516,7 @@ web_server_loop() {
   // Do we need to restart the system?
   if (systemRestartTime > 0 && millis() > systemRestartTime) {
     systemRestartTime = 0;
+    emondc_shutdown();
     wifi_disconnect();
     ESP.restart();
   }
@@ -1076,6 +1524,7 @@ web_server_loop() {
   // Do we need to reboot the system?
   if (systemRebootTime > 0 && millis() > systemRebootTime) {
     systemRebootTime = 0;
+    emondc_shutdown();
     wifi_disconnect();
     ESP.reset();
   }
@@ -30,12 +30,22 @@
 #include <ESPAsyncTCP.h>
 #include <ESPAsyncWebServer.h>
 
+// WebSocket clients kept at once, and how often status changes are pushed.
+#ifndef WS_MAX_CLIENTS
+#define WS_MAX_CLIENTS 2
+#endif
+#define WS_STATUS_INTERVAL_MS 1000UL
 
 extern AsyncWebServer server;
+extern AsyncWebSocket ws;
 extern String currentfirmware;
 
 extern void web_server_setup();
 extern void web_server_loop();
+
+// Send the latest values to WebSocket clients, call when there are new ones.
+extern void web_server_push_values();
+
 void dumpRequest(AsyncWebServerRequest *request);
 
 
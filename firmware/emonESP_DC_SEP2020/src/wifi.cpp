@@ -53,6 +53,12 @@ unsigned long Timer;
 String st, rssi;
 
 int wifi_mode = WIFI_MODE_STA;
+bool wifi_connecting = false;
+
+// each attempt at the configured network, before falling back to the AP.
+#define WIFI_CONNECT_TIMEOUT_MS 10000
+#define WIFI_CONNECT_ATTEMPTS   2
+static uint8_t wifi_attempt = 0;
 
 
 // -------------------------------------------------------------------
@@ -61,6 +67,7 @@ int wifi_mode = WIFI_MODE_STA;
 // -------------------------------------------------------------------
 void startAP() {
   DEBUG.print("Starting AP");
+  wifi_connecting = false;
   WiFi.mode(WIFI_STA);
   WiFi.disconnect();
   delay(100);
@@ -101,79 +108,62 @@ void startAP() {
 
 // -------------------------------------------------------------------
 // Start Client, attempt to connect to Wifi network
+// Returns straight away, wifi_loop() follows the association so sampling
+// carries on meanwhile.
 // -------------------------------------------------------------------
 void startClient() {
   DEBUG.print("Connecting to SSID: ");
-  DEBUG.print(esid.c_str());
+  DEBUG.println(esid.c_str());
   WiFi.hostname(esp_hostname);
   WiFi.begin(esid.c_str(), epass.c_str());
   Timer = millis();
+  wifi_connecting = true;
+  wifi_attempt = 0;
+}
 
-  int tries = 0;
-  while (WiFi.status() != WL_CONNECTED) {
-    delay(500);
-    Serial.print(".");
-    tries++;
-    if (tries == 20) break;
-    if (digitalRead(0) == LOW) {
-      Serial.println(" ");
-      startAP();
-      wifi_mode = WIFI_MODE_AP_ONLY;
-      return;
-    }
-  }
-  int attempt = 0;
-  while (WiFi.status() != WL_CONNECTED) {
-    if (digitalRead(0) == HIGH) {
-      DEBUG.println(" ");
-      DEBUG.print("Try Again...");
-      WiFi.disconnect();
-      delay(100);
-      WiFi.begin(esid.c_str(), epass.c_str());
-      tries = 0;
-      while (WiFi.status() != WL_CONNECTED) {
-        delay(500);
-        Serial.print(".");
-        tries++;
-        if (tries == 15) { Serial.println(" Network not found"); startAP(); wifi_mode = WIFI_MODE_AP_STA_RETRY; break; }
-        if (digitalRead(0) == LOW) {
-        Serial.println(" ");
-        startAP();
-        wifi_mode = WIFI_MODE_AP_ONLY;
-        break;
-        }
-      }
-      if (WIFI_MODE_AP_ONLY) break;
-      attempt++;
-      if (attempt == 3) {
-        DEBUG.println(" ");
-        startAP();
-        // AP mode with SSID in EEPROM, connection will retry in 5 minutes
-        wifi_mode = WIFI_MODE_AP_STA_RETRY;
-        return;
-      }
-    }
-    else if (digitalRead(0) == LOW) {
-      DEBUG.println(" ");
-      startAP();
-      wifi_mode = WIFI_MODE_AP_ONLY;
-      break;
-    }
-  }
+static void wifi_connected() {
+  wifi_connecting = false;
+  IPAddress myAddress = WiFi.localIP();
+  char tmpStr[40];
+  sprintf(tmpStr, "%d.%d.%d.%d", myAddress[0], myAddress[1], myAddress[2], myAddress[3]);
+  DEBUG.print("Connected, IP: ");
+  DEBUG.println(tmpStr);
+  // Copy the connected network and ipaddress to global strings for use in status request
+  connected_network = esid;
+  ipaddress = tmpStr;
+  if (boot_wifi_ms == 0) boot_wifi_ms = millis();
 
-  if (wifi_mode == WIFI_MODE_STA || wifi_mode == WIFI_MODE_AP_AND_STA) {
-    IPAddress myAddress = WiFi.localIP();
-    char tmpStr[40];
-    sprintf(tmpStr, "%d.%d.%d.%d", myAddress[0], myAddress[1], myAddress[2], myAddress[3]);
-    DEBUG.print("Connected, IP: ");
-    DEBUG.println(tmpStr);
-    // Copy the connected network and ipaddress to global strings for use in status request
-    connected_network = esid;
-    ipaddress = tmpStr;
+  // Start hostname broadcast
+  if (MDNS.begin(esp_hostname)) {
+    MDNS.addService("http", "tcp", 80);
   }
-  DEBUG.println(" ");
 }
 
+static void wifi_connect_loop() {
+  if (WiFi.status() == WL_CONNECTED) {
+    wifi_connected();
+    return;
+  }
+  if (digitalRead(0) == LOW) {
+    startAP();
+    wifi_mode = WIFI_MODE_AP_ONLY;
+    return;
+  }
+  if (millis() - Timer < WIFI_CONNECT_TIMEOUT_MS) return;
+
+  if (++wifi_attempt < WIFI_CONNECT_ATTEMPTS) {
+    DEBUG.println("Try Again...");
+    WiFi.disconnect();
+    WiFi.begin(esid.c_str(), epass.c_str());
+    Timer = millis();
+    return;
+  }
+  DEBUG.println("Network not found");
+  startAP();
+  // AP mode with SSID in EEPROM, connection will retry in 5 minutes
+  wifi_mode = WIFI_MODE_AP_STA_RETRY;
+  Timer = millis();
+}
 
 void wifi_setup() {
   WiFi.disconnect();
@@ -189,18 +179,12 @@ void wifi_setup() {
     startClient();
   }
 
-  // Start hostname broadcast in STA mode
-  if ((wifi_mode == WIFI_MODE_STA || wifi_mode == WIFI_MODE_AP_AND_STA)) {
-    if (MDNS.begin(esp_hostname)) {
-      MDNS.addService("http", "tcp", 80);
-    }
-  }
-
   Timer = millis();
 }
 
 void wifi_loop() {
 
+  if (wifi_connecting) wifi_connect_loop();
   dnsServer.processNextRequest(); // Captive portal DNS re-direct
   MDNS.update();
 
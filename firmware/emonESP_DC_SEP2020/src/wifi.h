@@ -42,6 +42,8 @@
 
 // The current WiFi mode
 extern int wifi_mode;
+// Associating with the configured network, the client modes are not usable yet.
+extern bool wifi_connecting;
 
 // Last discovered WiFi access points
 extern String st;
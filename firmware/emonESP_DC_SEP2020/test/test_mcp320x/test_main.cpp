@@ -0,0 +1,101 @@
+// emonDC MCP3208 burst read test, free to use and modify.
+
+// readBurst() against the readCH() loop emondc.cpp used to sample with, on
+// the native HAL's MCP3208: the same conversions, the same bus traffic, and
+// the time each takes per sample of all 8 channels, the bus time at the clock
+// each runs at as the HAL times it, plus the host's CPU time. pio test -e native
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "AH_MCP320x.h"
+#include "sampler.h"
+
+#define BENCH_SAMPLES 2000
+// the clock the loop ran at, the SD card's, as it shared its settings.
+#define LOOP_SPI_HZ 250000
+
+static AH_MCP320x adc(hal_mcp3208_cs, SPISettings(SAMPLER_ADC_HZ, MSBFIRST, SPI_MODE0));
+
+static void read_loop(uint16_t values[8]) {
+  for (int ch = 0; ch < 8; ch++) values[ch] = adc.readCH(ch);
+}
+
+void setUp(void) {
+  for (uint8_t ch = 0; ch < 8; ch++) hal_mcp3208_values[ch] = 0x111 * ch + 0x0A5;
+  hal_spi_reset_counts();
+}
+
+void tearDown(void) {}
+
+void test_burst_matches_readch(void) {
+  uint16_t loop[8], burst[8];
+  // full scale and each bit on its own, odd channels a bit lower.
+  for (int bit = -1; bit < 12; bit++) {
+    for (uint8_t ch = 0; ch < 8; ch++) hal_mcp3208_values[ch] = bit < 0 ? 0xFFF : (1 << bit) >> (ch & 1);
+    read_loop(loop);
+    adc.readBurst(burst, 0xFF);
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(loop, burst, 8);
+  }
+}
+
+void test_burst_mask_leaves_others(void) {
+  uint16_t burst[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+  adc.readBurst(burst, 0x05);
+  TEST_ASSERT_EQUAL_UINT16(hal_mcp3208_values[0], burst[0]);
+  TEST_ASSERT_EQUAL_UINT16(2, burst[1]);
+  TEST_ASSERT_EQUAL_UINT16(hal_mcp3208_values[2], burst[2]);
+  TEST_ASSERT_EQUAL_UINT16(4, burst[3]);
+  TEST_ASSERT_EQUAL(2, hal_spi_selects);
+}
+
+// the same 24 clocks and one chip select per channel either way, the saving
+// is in the bus clock and the CPU around each transfer.
+void test_bus_traffic(void) {
+  uint16_t values[8];
+  read_loop(values);
+  TEST_ASSERT_EQUAL(8, hal_spi_selects);
+  TEST_ASSERT_EQUAL(8 * 24, hal_spi_clocks);
+  hal_spi_reset_counts();
+  adc.readBurst(values, 0xFF);
+  TEST_ASSERT_EQUAL(8, hal_spi_selects);
+  TEST_ASSERT_EQUAL(8 * 24, hal_spi_clocks);
+}
+
+// the bus time is asserted, the totals printed. The host SPI library is a
+// plain call, so the loop does not pay what it does on the board for the
+// flash resident library and digitalWrite(): its total is the less of the two.
+void test_cost_per_sample(void) {
+  uint16_t values[8];
+  SPI.beginTransaction(SPISettings(LOOP_SPI_HZ, MSBFIRST, SPI_MODE0));
+  uint64_t bus_ns = hal_spi_bus_ns;
+  uint64_t start = hal_host_ns() + hal_spi_bus_ns;
+  for (int i = 0; i < BENCH_SAMPLES; i++) read_loop(values);
+  uint64_t loop_ns = hal_host_ns() + hal_spi_bus_ns - start;
+  uint64_t loop_bus_ns = hal_spi_bus_ns - bus_ns;
+
+  bus_ns = hal_spi_bus_ns;
+  start = hal_host_ns() + hal_spi_bus_ns;
+  for (int i = 0; i < BENCH_SAMPLES; i++) adc.readBurst(values, 0xFF);
+  uint64_t burst_ns = hal_host_ns() + hal_spi_bus_ns - start;
+  uint64_t burst_bus_ns = hal_spi_bus_ns - bus_ns;
+
+  TEST_ASSERT_EQUAL_UINT64(BENCH_SAMPLES * 8 * 24 * (1000000000ULL / LOOP_SPI_HZ), loop_bus_ns);
+  TEST_ASSERT_EQUAL_UINT64(BENCH_SAMPLES * 8 * 24 * (1000000000ULL / SAMPLER_ADC_HZ), burst_bus_ns);
+  TEST_ASSERT_EQUAL_HEX32(hal_spi1_clock_reg(LOOP_SPI_HZ), SPI1CLK); // the SD card's clock put back.
+
+  char line[160];
+  snprintf(line, sizeof(line), "us per 8 channel sample, bus (total): readCH loop at %luHz %.1f (%.1f), readBurst at %luHz %.1f (%.1f)",
+           (unsigned long)LOOP_SPI_HZ, loop_bus_ns / 1000.0 / BENCH_SAMPLES, loop_ns / 1000.0 / BENCH_SAMPLES,
+           (unsigned long)SAMPLER_ADC_HZ, burst_bus_ns / 1000.0 / BENCH_SAMPLES, burst_ns / 1000.0 / BENCH_SAMPLES);
+  TEST_MESSAGE(line);
+}
+
+int main(void) {
+  UNITY_BEGIN();
+  RUN_TEST(test_burst_matches_readch);
+  RUN_TEST(test_burst_mask_leaves_others);
+  RUN_TEST(test_bus_traffic);
+  RUN_TEST(test_cost_per_sample);
+  return UNITY_END();
+}